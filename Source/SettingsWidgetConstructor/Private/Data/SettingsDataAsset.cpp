@@ -0,0 +1,68 @@
+﻿// Copyright (c) Yevhenii Selivanov
+
+#include "Data/SettingsDataAsset.h"
+//---
+#include UE_INLINE_GENERATED_CPP_BY_NAME(SettingsDataAsset)
+
+// Returns the cached style brush of the button by specified state
+const FSlateBrush& USettingsDataAsset::GetButtonBrush(ESettingsButtonState State) const
+{
+	const int32 Index = FMath::Clamp(static_cast<int32>(State), 0, FSettingsThemeBrushes::ButtonStatesNum - 1);
+	return GetThemeBrushes().Button[Index];
+}
+
+// Returns the cached style brush of the checkbox by specified state
+const FSlateBrush& USettingsDataAsset::GetCheckboxBrush(ESettingsCheckboxState State) const
+{
+	const int32 Index = FMath::Clamp(static_cast<int32>(State), 0, FSettingsThemeBrushes::CheckboxStatesNum - 1);
+	return GetThemeBrushes().Checkbox[Index];
+}
+
+// Returns the cached style brush of the combobox by specified state
+const FSlateBrush& USettingsDataAsset::GetComboboxBrush(ESettingsButtonState State) const
+{
+	const int32 Index = FMath::Clamp(static_cast<int32>(State), 0, FSettingsThemeBrushes::ButtonStatesNum - 1);
+	return GetThemeBrushes().Combobox[Index];
+}
+
+// Returns the cached style brush of the slider by specified state
+const FSlateBrush& USettingsDataAsset::GetSliderBrush(ESettingsSliderState State) const
+{
+	const int32 Index = FMath::Clamp(static_cast<int32>(State), 0, FSettingsThemeBrushes::SliderStatesNum - 1);
+	return GetThemeBrushes().Slider[Index];
+}
+
+// Returns all style brushes, bakes them from theme data on first call
+const FSettingsThemeBrushes& USettingsDataAsset::GetThemeBrushes() const
+{
+	if (!ThemeBrushesInternal.bIsBaked)
+	{
+		ThemeBrushesInternal.Bake(ButtonThemeDataInternal, CheckboxThemeDataInternal, ComboboxThemeDataInternal, SliderThemeDataInternal, MiscThemeDataInternal);
+	}
+
+	return ThemeBrushesInternal;
+}
+
+// Marks all baked style brushes as outdated, so they will be baked again on next request
+void USettingsDataAsset::InvalidateThemeBrushes() const
+{
+	ThemeBrushesInternal.bIsBaked = false;
+}
+
+// Is called when config was reloaded to rebake all brushes
+void USettingsDataAsset::PostReloadConfig(FProperty* PropertyThatWasLoaded)
+{
+	Super::PostReloadConfig(PropertyThatWasLoaded);
+
+	InvalidateThemeBrushes();
+}
+
+#if WITH_EDITOR
+// Is called when any theme data was changed in editor to rebake all brushes
+void USettingsDataAsset::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+
+	InvalidateThemeBrushes();
+}
+#endif // WITH_EDITOR
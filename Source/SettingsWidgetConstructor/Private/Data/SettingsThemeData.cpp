@@ -2,8 +2,22 @@
 
 #include "Data/SettingsThemeData.h"
 //---
+#include "Engine/Texture.h"
+//---
 #include UE_INLINE_GENERATED_CPP_BY_NAME(SettingsThemeData)
 
+// Creates the style brush from this theme data
+FSlateBrush FSettingsThemeData::MakeBrush(const FSlateColor& TintColor, UTexture* OverrideTexture/* = nullptr*/) const
+{
+	FSlateBrush SlateBrush;
+	SlateBrush.TintColor = TintColor;
+	SlateBrush.DrawAs = DrawAs;
+	SlateBrush.Margin = Margin;
+	SlateBrush.SetImageSize(Size);
+	SlateBrush.SetResourceObject(OverrideTexture ? OverrideTexture : Texture.Get());
+	return SlateBrush;
+}
+
 // Default constructor to set default values
 FButtonThemeData::FButtonThemeData()
 {
@@ -62,3 +76,40 @@ FMiscThemeData::FMiscThemeData()
 
 	MenuBorderData.Margin = 0.45f;
 }
+
+// Creates all brushes by specified theme data
+void FSettingsThemeBrushes::Bake(const FButtonThemeData& ButtonThemeData, const FCheckboxThemeData& CheckboxThemeData, const FComboboxThemeData& ComboboxThemeData, const FSliderThemeData& SliderThemeData, const FMiscThemeData& MiscThemeData)
+{
+	// Normal, Hovered, Pressed colors are shared by all setting types
+	const FSlateColor StateColors[] = {MiscThemeData.ThemeColorNormal, MiscThemeData.ThemeColorHover, MiscThemeData.ThemeColorExtra};
+	constexpr int32 StateColorsNum = UE_ARRAY_COUNT(StateColors);
+	static const FSlateColor DisabledColor = FLinearColor::White;
+
+	for (int32 Index = 0; Index < ButtonStatesNum; ++Index)
+	{
+		const FSlateColor& TintColor = Index < StateColorsNum ? StateColors[Index] : DisabledColor;
+		Button[Index] = ButtonThemeData.MakeBrush(TintColor);
+		Combobox[Index] = ComboboxThemeData.MakeBrush(TintColor);
+	}
+
+	// Checkbox states are grouped by texture: unchecked, checked and undetermined, each of them has normal, hovered and pressed color
+	UTexture* CheckboxTextures[] = {CheckboxThemeData.Texture, CheckboxThemeData.CheckedTexture, CheckboxThemeData.UndeterminedTexture};
+	for (int32 Index = 0; Index < CheckboxStatesNum; ++Index)
+	{
+		const int32 TextureIndex = Index / StateColorsNum;
+		const int32 ColorIndex = Index % StateColorsNum;
+		Checkbox[Index] = CheckboxThemeData.MakeBrush(StateColors[ColorIndex], CheckboxTextures[TextureIndex]);
+	}
+
+	ComboboxArrow = ComboboxThemeData.Arrow.MakeBrush(MiscThemeData.ThemeColorNormal);
+	ComboboxBorder = ComboboxThemeData.Border.MakeBrush(MiscThemeData.ThemeColorNormal);
+
+	Slider[static_cast<int32>(ESettingsSliderState::NormalBar)] = SliderThemeData.MakeBrush(MiscThemeData.ThemeColorNormal);
+	Slider[static_cast<int32>(ESettingsSliderState::HoveredBar)] = SliderThemeData.MakeBrush(MiscThemeData.ThemeColorHover);
+	Slider[static_cast<int32>(ESettingsSliderState::NormalThumb)] = SliderThemeData.Thumb.MakeBrush(MiscThemeData.ThemeColorNormal);
+	Slider[static_cast<int32>(ESettingsSliderState::HoveredThumb)] = SliderThemeData.Thumb.MakeBrush(MiscThemeData.ThemeColorHover);
+
+	Tooltip = MiscThemeData.TooltipBackground.MakeBrush(MiscThemeData.TooltipBackgroundTint);
+
+	bIsBaked = true;
+}
@@ -83,6 +83,22 @@ void USettingSubWidget::SetCaptionText(const FText& NewCaptionText)
 	}
 }
 
+// Reports the height of this sub-widget to the main settings widget once it was laid out with a new height
+void USettingSubWidget::ReportMeasuredHeight()
+{
+	// Desired size is cached by the last layout, so it is zero until the widget is painted for the first time
+	const float DesiredHeight = GetDesiredSize().Y;
+	if (!SettingsWidgetInternal
+		|| DesiredHeight <= 0.f
+		|| FMath::IsNearlyEqual(DesiredHeight, MeasuredHeightInternal))
+	{
+		return;
+	}
+
+	MeasuredHeightInternal = DesiredHeight;
+	SettingsWidgetInternal->OnSettingRowHeightMeasured(GetSettingTag(), DesiredHeight);
+}
+
 // Called after the underlying slate widget is constructed
 void USettingButton::NativeConstruct()
 {
@@ -226,6 +242,14 @@ void USettingSlider::OnValueChanged(float Value)
 	SettingsWidgetInternal->SetSettingSlider(GetSettingTag(), Value);
 }
 
+// Is executed every tick when widget is enabled, reports the height once the text was laid out
+void USettingTextLine::NativeTick(const FGeometry& MyGeometry, float InDeltaTime)
+{
+	Super::NativeTick(MyGeometry, InDeltaTime);
+
+	ReportMeasuredHeight();
+}
+
 // Returns current text set in the Editable Text Box
 void USettingUserInput::GetEditableText(FText& OutText) const
 {
@@ -273,6 +297,14 @@ void USettingUserInput::OnTextChanged(const FText& Text)
 	SettingsWidgetInternal->SetSettingUserInput(GetSettingTag(), MewValue);
 }
 
+// Is executed every tick when widget is enabled, reports the height once the widget was laid out
+void USettingCustomWidget::NativeTick(const FGeometry& MyGeometry, float InDeltaTime)
+{
+	Super::NativeTick(MyGeometry, InDeltaTime);
+
+	ReportMeasuredHeight();
+}
+
 // Called after the underlying slate widget is constructed
 void USettingScrollBox::NativeConstruct()
 {
@@ -4,595 +4,274 @@
 //---
 #include "Blueprint/WidgetLayoutLibrary.h"
 #include "Components/SizeBox.h"
-#include "GameFramework/GameUserSettings.h"
+#include "Fonts/FontMeasure.h"
+#include "Framework/Application/SlateApplication.h"
+#include "Rendering/SlateRenderer.h"
+#include "TimerManager.h"
 //---
 #include "Data/SettingsDataAsset.h"
-#include "Data/SettingsDataTable.h"
+#include "SettingsSubsystem.h"
 #include "UI/SettingSubWidget.h"
 //---
 #include UE_INLINE_GENERATED_CPP_BY_NAME(SettingsWidget)
 
-// Try to find the setting row
-const FSettingsPicker& USettingsWidget::FindSettingRow(FName PotentialTagName) const
+// Returns the subsystem that owns all settings shown by this widget
+USettingsSubsystem* USettingsWidget::GetSettingsSubsystem() const
 {
-	if (PotentialTagName.IsNone())
-	{
-		return FSettingsPicker::Empty;
-	}
-
-	const FSettingsPicker* FoundRow = &FSettingsPicker::Empty;
+	return USettingsSubsystem::Get(this);
+}
 
-	// Find row by specified substring
-	const FString TagSubString(PotentialTagName.ToString());
-	for (const TTuple<FName, FSettingsPicker>& RowIt : SettingsTableRowsInternal)
-	{
-		const FString TagStringIt(RowIt.Key.ToString());
-		if (TagStringIt.Contains(TagSubString))
-		{
-			FoundRow = &RowIt.Value;
-			break;
-		}
-	}
+// Returns the amount of settings rows
+int32 USettingsWidget::GetSettingsTableRowsNum() const
+{
+	const USettingsSubsystem* SettingsSubsystem = GetSettingsSubsystem();
+	return SettingsSubsystem ? SettingsSubsystem->GetSettingsTableRowsNum() : 0;
+}
 
-	return *FoundRow;
+// Try to find the setting row
+const FSettingsPicker& USettingsWidget::FindSettingRow(FName PotentialTagName) const
+{
+	const USettingsSubsystem* SettingsSubsystem = GetSettingsSubsystem();
+	return SettingsSubsystem ? SettingsSubsystem->FindSettingRow(PotentialTagName) : FSettingsPicker::Empty;
 }
 
 // Returns the found row by specified tag
 const FSettingsPicker& USettingsWidget::GetSettingRow(const FSettingTag& SettingTag) const
 {
-	if (!SettingTag.IsValid())
-	{
-		return FSettingsPicker::Empty;
-	}
-
-	const FSettingsPicker* FoundRow = SettingsTableRowsInternal.Find(SettingTag.GetTagName());
-	return FoundRow ? *FoundRow : FSettingsPicker::Empty;
+	const USettingsSubsystem* SettingsSubsystem = GetSettingsSubsystem();
+	return SettingsSubsystem ? SettingsSubsystem->GetSettingRow(SettingTag) : FSettingsPicker::Empty;
 }
 
 // Save all settings into their configs
 void USettingsWidget::SaveSettings()
 {
-	ApplySettings();
-
-	for (const TTuple<FName, FSettingsPicker>& RowIt : SettingsTableRowsInternal)
+	if (USettingsSubsystem* SettingsSubsystem = GetSettingsSubsystem())
 	{
-		if (UObject* ContextObject = RowIt.Value.PrimaryData.StaticContextObject.Get())
-		{
-			ContextObject->SaveConfig();
-		}
+		SettingsSubsystem->SaveSettings();
 	}
 }
 
 // Apply all current settings on device
 void USettingsWidget::ApplySettings()
 {
-	UGameUserSettings* GameUserSettings = GEngine->GetGameUserSettings();
-	if (!GameUserSettings)
+	if (USettingsSubsystem* SettingsSubsystem = GetSettingsSubsystem())
 	{
-		return;
+		SettingsSubsystem->ApplySettings();
 	}
+}
 
-	constexpr bool bCheckForCommandLineOverrides = false;
-	GameUserSettings->ApplySettings(bCheckForCommandLineOverrides);
+// Calls real setters of all staged values in one batch
+void USettingsWidget::ApplyPendingSettings()
+{
+	if (USettingsSubsystem* SettingsSubsystem = GetSettingsSubsystem())
+	{
+		SettingsSubsystem->ApplyPendingSettings();
+	}
+}
+
+// Discards all staged values and shows current values again
+void USettingsWidget::RevertPendingSettings()
+{
+	if (USettingsSubsystem* SettingsSubsystem = GetSettingsSubsystem())
+	{
+		SettingsSubsystem->RevertPendingSettings();
+	}
 }
 
 // Update settings on UI
 void USettingsWidget::UpdateSettings(const FGameplayTagContainer& SettingsToUpdate)
 {
-	if (SettingsToUpdate.IsEmpty()
-		|| !SettingsToUpdate.IsValidIndex(0))
+	if (USettingsSubsystem* SettingsSubsystem = GetSettingsSubsystem())
 	{
-		return;
+		SettingsSubsystem->UpdateSettings(SettingsToUpdate);
 	}
+}
 
-	if (SettingsTableRowsInternal.IsEmpty())
+// Marks cached getter results of specified settings as outdated
+void USettingsWidget::InvalidateSettingsCache(const FGameplayTagContainer& SettingsToInvalidate)
+{
+	if (USettingsSubsystem* SettingsSubsystem = GetSettingsSubsystem())
 	{
-		UpdateSettingsTableRows();
+		SettingsSubsystem->InvalidateSettingsCache(SettingsToInvalidate);
 	}
+}
 
-	for (const TTuple<FName, FSettingsPicker>& RowIt : SettingsTableRowsInternal)
+// Marks cached getter results of all settings as outdated
+void USettingsWidget::InvalidateAllSettingsCache()
+{
+	if (USettingsSubsystem* SettingsSubsystem = GetSettingsSubsystem())
 	{
-		const FSettingsPicker& Setting = RowIt.Value;
-		const FSettingTag& SettingTag = Setting.PrimaryData.Tag;
-		if (!SettingTag.IsValid()
-			|| !SettingTag.MatchesAny(SettingsToUpdate))
-		{
-			continue;
-		}
-
-		const FSettingsDataBase* ChosenData = Setting.GetChosenSettingsData();
-		if (!ChosenData)
-		{
-			continue;
-		}
-
-		if (ChosenData == &Setting.Checkbox)
-		{
-			const bool NewValue = GetCheckboxValue(SettingTag);
-			SetSettingCheckbox(SettingTag, NewValue);
-		}
-		else if (ChosenData == &Setting.Combobox)
-		{
-			const int32 NewValue = GetComboboxIndex(SettingTag);
-			SetSettingComboboxIndex(SettingTag, NewValue);
-		}
-		else if (ChosenData == &Setting.Slider)
-		{
-			const double NewValue = GetSliderValue(SettingTag);
-			SetSettingSlider(SettingTag, NewValue);
-		}
-		else if (ChosenData == &Setting.TextLine)
-		{
-			FText NewValue = TEXT_NONE;
-			GetTextLineValue(SettingTag, /*Out*/NewValue);
-			SetSettingTextLine(SettingTag, NewValue);
-		}
-		else if (ChosenData == &Setting.UserInput)
-		{
-			const FName NewValue = GetUserInputValue(SettingTag);
-			SetSettingUserInput(SettingTag, NewValue);
-		}
+		SettingsSubsystem->InvalidateAllSettingsCache();
 	}
 }
 
 // Returns the name of found tag by specified function
 const FSettingTag& USettingsWidget::GetTagByFunction(const FSettingFunctionPicker& FunctionPicker) const
 {
-	for (const TTuple<FName, FSettingsPicker>& RowIt : SettingsTableRowsInternal)
-	{
-		const FSettingsPrimary& PrimaryData = RowIt.Value.PrimaryData;
-		if (PrimaryData.Getter == FunctionPicker
-			|| PrimaryData.Setter == FunctionPicker)
-		{
-			return PrimaryData.Tag;
-		}
-	}
-
-	return FSettingTag::EmptySettingTag;
+	const USettingsSubsystem* SettingsSubsystem = GetSettingsSubsystem();
+	return SettingsSubsystem ? SettingsSubsystem->GetTagByFunction(FunctionPicker) : FSettingTag::EmptySettingTag;
 }
 
 // Set value to the option by tag
 void USettingsWidget::SetSettingValue(FName TagName, const FString& Value)
 {
-	const FSettingsPicker& FoundRow = FindSettingRow(TagName);
-	if (!FoundRow.IsValid())
+	if (USettingsSubsystem* SettingsSubsystem = GetSettingsSubsystem())
 	{
-		return;
+		SettingsSubsystem->SetSettingValue(TagName, Value);
 	}
+}
 
-	const FSettingsDataBase* ChosenData = FoundRow.GetChosenSettingsData();
-	if (!ChosenData)
-	{
-		return;
-	}
-
-	const FSettingTag& Tag = FoundRow.PrimaryData.Tag;
-	if (!Tag.IsValid())
-	{
-		return;
-	}
-
-	if (ChosenData == &FoundRow.Button)
-	{
-		SetSettingButtonPressed(Tag);
-	}
-	else if (ChosenData == &FoundRow.Checkbox)
-	{
-		const bool NewValue = Value.ToBool();
-		SetSettingCheckbox(Tag, NewValue);
-	}
-	else if (ChosenData == &FoundRow.Combobox)
-	{
-		if (Value.IsNumeric())
-		{
-			const int32 NewValue = FCString::Atoi(*Value);
-			SetSettingComboboxIndex(Tag, NewValue);
-		}
-		else
-		{
-			static const FString Delimiter = TEXT(",");
-			TArray<FString> SeparatedStrings;
-			Value.ParseIntoArray(SeparatedStrings, *Delimiter);
-
-			TArray<FText> NewMembers;
-			NewMembers.Reserve(SeparatedStrings.Num());
-			for (FString& StringIt : SeparatedStrings)
-			{
-				NewMembers.Emplace(FText::FromString(MoveTemp(StringIt)));
-			}
-			SetSettingComboboxMembers(Tag, NewMembers);
-		}
-	}
-	else if (ChosenData == &FoundRow.Slider)
-	{
-		const double NewValue = FCString::Atod(*Value);
-		SetSettingSlider(Tag, NewValue);
-	}
-	else if (ChosenData == &FoundRow.TextLine)
-	{
-		const FText NewValue = FText::FromString(Value);
-		SetSettingTextLine(Tag, NewValue);
-	}
-	else if (ChosenData == &FoundRow.UserInput)
+// Sets typed values to specified settings in one call without string parsing
+void USettingsWidget::SetSettingValues(const TArray<FSettingTag>& SettingTags, const TArray<FSettingValue>& Values)
+{
+	if (USettingsSubsystem* SettingsSubsystem = GetSettingsSubsystem())
 	{
-		const FName NewValue = *Value;
-		SetSettingUserInput(Tag, NewValue);
+		SettingsSubsystem->SetSettingValues(SettingTags, Values);
 	}
 }
 
 // Press button
 void USettingsWidget::SetSettingButtonPressed(const FSettingTag& ButtonTag)
 {
-	if (!ButtonTag.IsValid())
-	{
-		return;
-	}
-
-	const FSettingsPicker* SettingsRowPtr = SettingsTableRowsInternal.Find(ButtonTag.GetTagName());
-	if (!SettingsRowPtr)
+	if (USettingsSubsystem* SettingsSubsystem = GetSettingsSubsystem())
 	{
-		return;
+		SettingsSubsystem->SetSettingButtonPressed(ButtonTag);
 	}
-
-	SettingsRowPtr->Button.OnButtonPressed.ExecuteIfBound();
-
-	UpdateSettings(SettingsRowPtr->PrimaryData.SettingsToUpdate);
-
-	PlayUIClickSFX();
 }
 
 // Toggle checkbox
 void USettingsWidget::SetSettingCheckbox(const FSettingTag& CheckboxTag, bool InValue)
 {
-	if (!CheckboxTag.IsValid())
+	if (USettingsSubsystem* SettingsSubsystem = GetSettingsSubsystem())
 	{
-		return;
+		SettingsSubsystem->SetSettingCheckbox(CheckboxTag, InValue);
 	}
-
-	FSettingsPicker* SettingsRowPtr = SettingsTableRowsInternal.Find(CheckboxTag.GetTagName());
-	if (!SettingsRowPtr)
-	{
-		return;
-	}
-
-	bool& bIsSetRef = SettingsRowPtr->Checkbox.bIsSet;
-	if (bIsSetRef == InValue)
-	{
-		return;
-	}
-
-	bIsSetRef = InValue;
-	SettingsRowPtr->Checkbox.OnSetterBool.ExecuteIfBound(InValue);
-	UpdateSettings(SettingsRowPtr->PrimaryData.SettingsToUpdate);
-
-	// BP implementation
-	SetCheckbox(CheckboxTag, InValue);
-	PlayUIClickSFX();
 }
 
 // Set chosen member index for a combobox
 void USettingsWidget::SetSettingComboboxIndex(const FSettingTag& ComboboxTag, int32 InValue)
 {
-	if (!ComboboxTag.IsValid())
-	{
-		return;
-	}
-
-	if (InValue == INDEX_NONE)
+	if (USettingsSubsystem* SettingsSubsystem = GetSettingsSubsystem())
 	{
-		return;
-	}
-
-	FSettingsPicker* SettingsRowPtr = SettingsTableRowsInternal.Find(ComboboxTag.GetTagName());
-	if (!SettingsRowPtr)
-	{
-		return;
+		SettingsSubsystem->SetSettingComboboxIndex(ComboboxTag, InValue);
 	}
-
-	FSettingsPicker& SettingsRowRef = *SettingsRowPtr;
-	int32& ChosenMemberIndexRef = SettingsRowRef.Combobox.ChosenMemberIndex;
-	if (ChosenMemberIndexRef == InValue)
-	{
-		return;
-	}
-
-	ChosenMemberIndexRef = InValue;
-	SettingsRowRef.Combobox.OnSetterInt.ExecuteIfBound(InValue);
-	UpdateSettings(SettingsRowRef.PrimaryData.SettingsToUpdate);
-
-	// BP implementation
-	SetComboboxIndex(ComboboxTag, InValue);
 }
 
 // Set new members for a combobox
 void USettingsWidget::SetSettingComboboxMembers(const FSettingTag& ComboboxTag, const TArray<FText>& InValue)
 {
-	if (!ComboboxTag.IsValid())
-	{
-		return;
-	}
-
-	FSettingsPicker* SettingsRowPtr = SettingsTableRowsInternal.Find(ComboboxTag.GetTagName());
-	if (!SettingsRowPtr)
+	if (USettingsSubsystem* SettingsSubsystem = GetSettingsSubsystem())
 	{
-		return;
+		SettingsSubsystem->SetSettingComboboxMembers(ComboboxTag, InValue);
 	}
-
-	SettingsRowPtr->Combobox.Members = InValue;
-	SettingsRowPtr->Combobox.OnSetMembers.ExecuteIfBound(InValue);
-
-	// BP implementation
-	SetComboboxMembers(ComboboxTag, InValue);
 }
 
 // Set current value for a slider
 void USettingsWidget::SetSettingSlider(const FSettingTag& SliderTag, double InValue)
 {
-	if (!SliderTag.IsValid())
+	if (USettingsSubsystem* SettingsSubsystem = GetSettingsSubsystem())
 	{
-		return;
+		SettingsSubsystem->SetSettingSlider(SliderTag, InValue);
 	}
-
-	FSettingsPicker* SettingsRowPtr = SettingsTableRowsInternal.Find(SliderTag.GetTagName());
-	if (!SettingsRowPtr)
-	{
-		return;
-	}
-
-	static constexpr double MinValue = 0.0;
-	static constexpr float MaxValue = 1.0;
-	const double NewValue = FMath::Clamp(InValue, MinValue, MaxValue);
-	double& ChosenValueRef = SettingsRowPtr->Slider.ChosenValue;
-	if (ChosenValueRef == NewValue)
-	{
-		return;
-	}
-
-	ChosenValueRef = NewValue;
-	SettingsRowPtr->Slider.OnSetterFloat.ExecuteIfBound(InValue);
-	UpdateSettings(SettingsRowPtr->PrimaryData.SettingsToUpdate);
-
-	// BP implementation
-	SetSlider(SliderTag, InValue);
 }
 
 // Set new text
 void USettingsWidget::SetSettingTextLine(const FSettingTag& TextLineTag, const FText& InValue)
 {
-	if (!TextLineTag.IsValid())
-	{
-		return;
-	}
-
-	FSettingsPicker* SettingsRowPtr = SettingsTableRowsInternal.Find(TextLineTag.GetTagName());
-	if (!SettingsRowPtr)
-	{
-		return;
-	}
-
-	FSettingsPrimary& PrimaryRef = SettingsRowPtr->PrimaryData;
-	FText& CaptionRef = PrimaryRef.Caption;
-	if (CaptionRef.EqualTo(InValue))
-	{
-		return;
-	}
-
-	CaptionRef = InValue;
-	SettingsRowPtr->TextLine.OnSetterText.ExecuteIfBound(InValue);
-	UpdateSettings(PrimaryRef.SettingsToUpdate);
-
-	if (USettingTextLine* SettingTextLine = Cast<USettingTextLine>(PrimaryRef.SettingSubWidget))
+	if (USettingsSubsystem* SettingsSubsystem = GetSettingsSubsystem())
 	{
-		SettingTextLine->SetCaptionText(InValue);
+		SettingsSubsystem->SetSettingTextLine(TextLineTag, InValue);
 	}
 }
 
 // Set new text for an input box
 void USettingsWidget::SetSettingUserInput(const FSettingTag& UserInputTag, FName InValue)
 {
-	if (!UserInputTag.IsValid())
+	if (USettingsSubsystem* SettingsSubsystem = GetSettingsSubsystem())
 	{
-		return;
-	}
-
-	FSettingsPicker* SettingsRowPtr = SettingsTableRowsInternal.Find(UserInputTag.GetTagName());
-	if (!SettingsRowPtr)
-	{
-		return;
-	}
-
-	FSettingsUserInput& UserInputRef = SettingsRowPtr->UserInput;
-	if (UserInputRef.UserInput.IsEqual(InValue)
-		|| InValue.IsNone())
-	{
-		// Is not needed to update
-		return;
+		SettingsSubsystem->SetSettingUserInput(UserInputTag, InValue);
 	}
-
-	if (UserInputRef.MaxCharactersNumber > 0)
-	{
-		// Limit the length of the string
-		const FString NewValueStr = InValue.ToString().Left(UserInputRef.MaxCharactersNumber);
-		InValue = *NewValueStr;
-
-		if (USettingUserInput* SettingUserInput = Cast<USettingUserInput>(SettingsRowPtr->PrimaryData.SettingSubWidget.Get()))
-		{
-			SettingUserInput->SetEditableText(FText::FromString(NewValueStr));
-		}
-	}
-
-	UserInputRef.UserInput = InValue;
-	UserInputRef.OnSetterName.ExecuteIfBound(InValue);
-	UpdateSettings(SettingsRowPtr->PrimaryData.SettingsToUpdate);
-
-	// BP implementation
-	SetUserInput(UserInputTag, InValue);
-	PlayUIClickSFX();
 }
 
 // Set new custom widget for setting by specified tag
 void USettingsWidget::SetSettingCustomWidget(const FSettingTag& CustomWidgetTag, USettingCustomWidget* InCustomWidget)
 {
-	if (!CustomWidgetTag.IsValid())
+	if (USettingsSubsystem* SettingsSubsystem = GetSettingsSubsystem())
 	{
-		return;
-	}
-
-	FSettingsPicker* SettingsRowPtr = SettingsTableRowsInternal.Find(CustomWidgetTag.GetTagName());
-	if (!SettingsRowPtr)
-	{
-		return;
+		SettingsSubsystem->SetSettingCustomWidget(CustomWidgetTag, InCustomWidget);
 	}
+}
 
-	TWeakObjectPtr<USettingSubWidget>& CustomWidgetRef = SettingsRowPtr->PrimaryData.SettingSubWidget;
-	if (CustomWidgetRef == InCustomWidget)
+// Returns typed values of specified settings in one call without string conversion
+void USettingsWidget::GetSettingValues(const TArray<FSettingTag>& SettingTags, TArray<FSettingValue>& OutValues) const
+{
+	if (const USettingsSubsystem* SettingsSubsystem = GetSettingsSubsystem())
 	{
-		return;
+		SettingsSubsystem->GetSettingValues(SettingTags, OutValues);
 	}
-
-	CustomWidgetRef.Reset();
-	CustomWidgetRef = InCustomWidget;
-	SettingsRowPtr->CustomWidget.OnSetterWidget.ExecuteIfBound(InCustomWidget);
-	UpdateSettings(SettingsRowPtr->PrimaryData.SettingsToUpdate);
 }
 
 // Returns is a checkbox toggled
 bool USettingsWidget::GetCheckboxValue(const FSettingTag& CheckboxTag) const
 {
-	if (!CheckboxTag.IsValid())
-	{
-		return false;
-	}
-
-	const FSettingsPicker& FoundRow = GetSettingRow(CheckboxTag);
-	bool Value = false;
-	if (FoundRow.IsValid())
-	{
-		const FSettingsCheckbox& Data = FoundRow.Checkbox;
-		Value = Data.bIsSet;
-
-		const USettingFunctionTemplate::FOnGetterBool& Getter = Data.OnGetterBool;
-		if (Getter.IsBound())
-		{
-			Value = Getter.Execute();
-		}
-	}
-	return Value;
+	const USettingsSubsystem* SettingsSubsystem = GetSettingsSubsystem();
+	return SettingsSubsystem ? SettingsSubsystem->GetCheckboxValue(CheckboxTag) : false;
 }
 
 // Returns chosen member index of a combobox
 int32 USettingsWidget::GetComboboxIndex(const FSettingTag& ComboboxTag) const
 {
-	const FSettingsPicker& FoundRow = GetSettingRow(ComboboxTag);
-	int32 Value = false;
-	if (FoundRow.IsValid())
-	{
-		const FSettingsCombobox& Data = FoundRow.Combobox;
-		Value = Data.ChosenMemberIndex;
-
-		const USettingFunctionTemplate::FOnGetterInt& Getter = Data.OnGetterInt;
-		if (Getter.IsBound())
-		{
-			Value = Getter.Execute();
-		}
-	}
-	return Value;
+	const USettingsSubsystem* SettingsSubsystem = GetSettingsSubsystem();
+	return SettingsSubsystem ? SettingsSubsystem->GetComboboxIndex(ComboboxTag) : INDEX_NONE;
 }
 
 // Get all members of a combobox
 void USettingsWidget::GetComboboxMembers(const FSettingTag& ComboboxTag, TArray<FText>& OutMembers) const
 {
-	const FSettingsPicker& FoundRow = GetSettingRow(ComboboxTag);
-	if (FoundRow.IsValid())
+	if (const USettingsSubsystem* SettingsSubsystem = GetSettingsSubsystem())
 	{
-		const FSettingsCombobox& Data = FoundRow.Combobox;
-		OutMembers = Data.Members;
-
-		const USettingFunctionTemplate::FOnGetMembers& Getter = Data.OnGetMembers;
-		if (Getter.IsBound())
-		{
-			Getter.Execute(OutMembers);
-		}
+		SettingsSubsystem->GetComboboxMembers(ComboboxTag, OutMembers);
 	}
 }
 
 // Get current value of a slider [0...1]
 double USettingsWidget::GetSliderValue(const FSettingTag& SliderTag) const
 {
-	const FSettingsPicker& FoundRow = GetSettingRow(SliderTag);
-	double Value = 0.0;
-	if (FoundRow.IsValid())
-	{
-		const FSettingsSlider& Data = FoundRow.Slider;
-		Value = Data.ChosenValue;
-
-		const USettingFunctionTemplate::FOnGetterFloat& Getter = Data.OnGetterFloat;
-		if (Getter.IsBound())
-		{
-			Value = Getter.Execute();
-		}
-	}
-	return Value;
+	const USettingsSubsystem* SettingsSubsystem = GetSettingsSubsystem();
+	return SettingsSubsystem ? SettingsSubsystem->GetSliderValue(SliderTag) : 0.0;
 }
 
 // Get current text of a simple text widget
 void USettingsWidget::GetTextLineValue(const FSettingTag& TextLineTag, FText& OutText) const
 {
-	const FSettingsPicker& FoundRow = GetSettingRow(TextLineTag);
-	if (FoundRow.IsValid())
+	if (const USettingsSubsystem* SettingsSubsystem = GetSettingsSubsystem())
 	{
-		OutText = FoundRow.PrimaryData.Caption;
-
-		const USettingFunctionTemplate::FOnGetterText& Getter = FoundRow.TextLine.OnGetterText;
-		if (Getter.IsBound())
-		{
-			Getter.Execute(OutText);
-		}
+		SettingsSubsystem->GetTextLineValue(TextLineTag, OutText);
 	}
 }
 
 // Get current input name of the text input
 FName USettingsWidget::GetUserInputValue(const FSettingTag& UserInputTag) const
 {
-	const FSettingsPicker& FoundRow = GetSettingRow(UserInputTag);
-	FName Value = NAME_None;
-	if (FoundRow.IsValid())
-	{
-		const FSettingsUserInput& Data = FoundRow.UserInput;
-		Value = Data.UserInput;
-
-		const USettingFunctionTemplate::FOnGetterName& Getter = Data.OnGetterName;
-		if (Getter.IsBound())
-		{
-			Value = Getter.Execute();
-		}
-	}
-	return Value;
+	const USettingsSubsystem* SettingsSubsystem = GetSettingsSubsystem();
+	return SettingsSubsystem ? SettingsSubsystem->GetUserInputValue(UserInputTag) : NAME_None;
 }
 
 // Get custom widget of the setting by specified tag
 USettingCustomWidget* USettingsWidget::GetCustomWidget(const FSettingTag& CustomWidgetTag) const
 {
-	const FSettingsPicker& FoundRow = GetSettingRow(CustomWidgetTag);
-	USettingCustomWidget* CustomWidget = nullptr;
-	if (FoundRow.IsValid())
-	{
-		CustomWidget = Cast<USettingCustomWidget>(FoundRow.PrimaryData.SettingSubWidget.Get());
+	const USettingsSubsystem* SettingsSubsystem = GetSettingsSubsystem();
+	USettingCustomWidget* CustomWidget = SettingsSubsystem ? Cast<USettingCustomWidget>(SettingsSubsystem->GetCustomWidget(CustomWidgetTag)) : nullptr;
 
-		const USettingFunctionTemplate::FOnGetterWidget& Getter = FoundRow.CustomWidget.OnGetterWidget;
-		if (Getter.IsBound())
-		{
-			CustomWidget = Getter.Execute();
-		}
-	}
-	return CustomWidget;
+	// Fallback to the widget created by this view if it was never set to the subsystem
+	return CustomWidget ? CustomWidget : Cast<USettingCustomWidget>(GetSettingSubWidget(CustomWidgetTag));
 }
 
 // Get setting widget object by specified tag
 USettingSubWidget* USettingsWidget::GetSettingSubWidget(const FSettingTag& SettingTag) const
 {
-	const FSettingsPrimary& PrimaryData = GetSettingRow(SettingTag).PrimaryData;
-	return PrimaryData.IsValid() ? PrimaryData.SettingSubWidget.Get() : nullptr;
+	const TObjectPtr<USettingSubWidget>* SettingSubWidget = SettingTag.IsValid() ? SettingSubWidgetsInternal.Find(SettingTag.GetTagName()) : nullptr;
+	return SettingSubWidget ? SettingSubWidget->Get() : nullptr;
 }
 
 // Returns the size of the Settings widget on the screen
@@ -616,51 +295,46 @@ FVector2D USettingsWidget::GetSubWidgetsSize(int32 SectionsBitmask) const
 		return FVector2D::ZeroVector;
 	}
 
-	TArray<const UWidget*> DesiredWidgets;
-
-	constexpr int32 HeaderAlignment = static_cast<int32>(EMyVerticalAlignment::Header);
-	if (HeaderAlignment & SectionsBitmask)
+	FVector2D SubWidgetsSize = FVector2D::ZeroVector;
+	auto AddSectionSize = [&SubWidgetsSize, SectionsBitmask](EMyVerticalAlignment Section, UWidget* SectionWidget, float SectionHeight)
 	{
-		DesiredWidgets.Emplace(HeaderVerticalBox);
-	}
+		if (!(static_cast<int32>(Section) & SectionsBitmask))
+		{
+			return;
+		}
 
-	constexpr int32 ContentAlignment = static_cast<int32>(EMyVerticalAlignment::Content);
-	if (ContentAlignment & SectionsBitmask)
-	{
-		DesiredWidgets.Emplace(ContentHorizontalBox);
-	}
+		SubWidgetsSize.X += SectionWidget ? SectionWidget->GetDesiredSize().X : 0.f;
+		SubWidgetsSize.Y += SectionHeight;
+	};
 
-	constexpr int32 FooterAlignment = static_cast<int32>(EMyVerticalAlignment::Footer);
-	if (FooterAlignment & SectionsBitmask)
-	{
-		DesiredWidgets.Emplace(FooterVerticalBox);
-	}
+	AddSectionSize(EMyVerticalAlignment::Header, HeaderVerticalBox, HeaderHeightInternal);
+	AddSectionSize(EMyVerticalAlignment::Content, ContentHorizontalBox, ContentHeightInternal);
+	AddSectionSize(EMyVerticalAlignment::Footer, FooterVerticalBox, FooterHeightInternal);
 
-	FVector2D SubWidgetsHeight = FVector2D::ZeroVector;
-	for (const UWidget* DesiredWidgetIt : DesiredWidgets)
-	{
-		if (DesiredWidgetIt)
-		{
-			const FVector2D SubWidgetHeight = DesiredWidgetIt->GetDesiredSize();
-			ensureAlwaysMsgf(!SubWidgetHeight.IsZero(), TEXT("ASSERT: 'SubWidgetHeight' is zero, can't get the size of subwidget, most likely widget is not initialized yet, call ForceLayoutPrepass()"));
-			SubWidgetsHeight += SubWidgetHeight;
-		}
-	}
-	return SubWidgetsHeight;
+	return SubWidgetsSize;
 }
 
-
 // Returns the height of a setting scrollbox on the screen
 float USettingsWidget::GetScrollBoxHeight() const
 {
+	UObject* WorldContextObject = GetOwningPlayer();
+	const FVector2D ViewportSize = UWidgetLayoutLibrary::GetViewportSize(WorldContextObject);
+	const float ViewportScale = UWidgetLayoutLibrary::GetViewportScale(WorldContextObject);
+	if (CachedScrollBoxHeightInternal >= 0.f
+		&& CachedViewportSizeInternal.Equals(ViewportSize)
+		&& FMath::IsNearlyEqual(CachedViewportScaleInternal, ViewportScale))
+	{
+		// Nothing is changed since last calculation
+		return CachedScrollBoxHeightInternal;
+	}
+
 	const USettingsDataAsset& SettingsData = USettingsDataAsset::Get();
 
 	// The widget size
 	const FVector2D SettingsSize = GetSettingsSize();
 
-	// Margin size
-	constexpr int32 Margins = static_cast<int32>(EMyVerticalAlignment::Margins);
-	const FVector2D MarginsSize = GetSubWidgetsSize(Margins);
+	// Margin size, only the height is needed, so widths of sections are not laid out
+	const float MarginsHeight = HeaderHeightInternal + FooterHeightInternal;
 
 	// Additional padding sizes
 	float Paddings = 0.f;
@@ -669,46 +343,38 @@ float USettingsWidget::GetScrollBoxHeight() const
 	const FMargin ScrollBoxPadding = SettingsData.GetScrollboxPadding();
 	Paddings += ScrollBoxPadding.Top + ScrollBoxPadding.Bottom;
 
-	const float ScrollBoxHeight = (SettingsSize - MarginsSize).Y - Paddings;
+	const float ScrollBoxHeight = SettingsSize.Y - MarginsHeight - Paddings;
 
 	// Scale scrollbox
 	const float PercentSize = FMath::Clamp(SettingsData.GetScrollboxPercentHeight(), 0.f, 1.f);
-	const float ScaledHeight = ScrollBoxHeight * PercentSize;
+	const float ScaledHeight = FMath::Max(ScrollBoxHeight * PercentSize, 0.f);
+
+	CachedViewportSizeInternal = ViewportSize;
+	CachedViewportScaleInternal = ViewportScale;
+	CachedScrollBoxHeightInternal = ScaledHeight;
 
 	return ScaledHeight;
 }
 
 // Is blueprint-event called that returns the style brush by specified button state
-FSlateBrush USettingsWidget::GetButtonBrush(ESettingsButtonState State) const
+const FSlateBrush& USettingsWidget::GetButtonBrush(ESettingsButtonState State) const
 {
-	const USettingsDataAsset& SettingsDataAsset = USettingsDataAsset::Get();
-	const FMiscThemeData& MiscThemeData = SettingsDataAsset.GetMiscThemeData();
-	const FButtonThemeData& ButtonThemeData = SettingsDataAsset.GetButtonThemeData();
+	return USettingsDataAsset::Get().GetButtonBrush(State);
+}
 
-	FSlateColor SlateColor;
-	switch (State)
+// Called once when the widget is created, starts listening changes of the Settings Subsystem
+void USettingsWidget::NativeOnInitialized()
+{
+	Super::NativeOnInitialized();
+
+	if (USettingsSubsystem* SettingsSubsystem = GetSettingsSubsystem())
 	{
-	case ESettingsButtonState::Normal:
-		SlateColor = MiscThemeData.ThemeColorNormal;
-		break;
-	case ESettingsButtonState::Hovered:
-		SlateColor = MiscThemeData.ThemeColorHover;
-		break;
-	case ESettingsButtonState::Pressed:
-		SlateColor = MiscThemeData.ThemeColorExtra;
-		break;
-	default:
-		SlateColor = FLinearColor::White;
+		SettingsSubsystem->OnSettingChanged.AddUniqueDynamic(this, &ThisClass::OnSettingChanged);
+		SettingsSubsystem->OnComboboxMembersChanged.AddUniqueDynamic(this, &ThisClass::OnComboboxMembersChanged);
+		SettingsSubsystem->OnRestartRequiredChanged.AddUniqueDynamic(this, &ThisClass::OnRestartRequiredChanged);
+		SettingsSubsystem->OnSettingLoadingChanged.AddUniqueDynamic(this, &ThisClass::OnSettingLoadingChanged);
+		SettingsSubsystem->OnSettingInFlightChanged.AddUniqueDynamic(this, &ThisClass::OnSettingInFlightChanged);
 	}
-
-	FSlateBrush SlateBrush;
-	SlateBrush.TintColor = SlateColor;
-	SlateBrush.DrawAs = ButtonThemeData.DrawAs;
-	SlateBrush.Margin = ButtonThemeData.Margin;
-	SlateBrush.SetImageSize(ButtonThemeData.Size);
-	SlateBrush.SetResourceObject(ButtonThemeData.Texture);
-
-	return SlateBrush;
 }
 
 // Called after the underlying slate widget is constructed
@@ -716,21 +382,93 @@ void USettingsWidget::NativeConstruct()
 {
 	Super::NativeConstruct();
 
+	if (!ViewportResizedHandleInternal.IsValid())
+	{
+		ViewportResizedHandleInternal = FViewport::ViewportResizedEvent.AddUObject(this, &ThisClass::OnViewportResized);
+	}
+
+	if (!WindowDPIScaleChangedHandleInternal.IsValid()
+		&& FSlateApplication::IsInitialized())
+	{
+		WindowDPIScaleChangedHandleInternal = FSlateApplication::Get().OnWindowDPIScaleChanged().AddUObject(this, &ThisClass::OnWindowDPIScaleChanged);
+	}
+
 	if (USettingsDataAsset::Get().IsAutoConstruct())
 	{
 		TryConstructSettings();
 	}
 }
 
+// Called when the underlying slate widget is destructed, unbinds from viewport events
+void USettingsWidget::NativeDestruct()
+{
+	FViewport::ViewportResizedEvent.Remove(ViewportResizedWhenInitHandleInternal);
+	ViewportResizedWhenInitHandleInternal.Reset();
+
+	FViewport::ViewportResizedEvent.Remove(ViewportResizedHandleInternal);
+	ViewportResizedHandleInternal.Reset();
+
+	if (FSlateApplication::IsInitialized())
+	{
+		FSlateApplication::Get().OnWindowDPIScaleChanged().Remove(WindowDPIScaleChangedHandleInternal);
+	}
+	WindowDPIScaleChangedHandleInternal.Reset();
+
+	Super::NativeDestruct();
+}
+
 // Is called right after the game was started and windows size is set to construct settings
 void USettingsWidget::OnViewportResizedWhenInit(FViewport* Viewport, uint32 Index)
 {
-	if (FViewport::ViewportResizedEvent.IsBoundToObject(this))
+	FViewport::ViewportResizedEvent.Remove(ViewportResizedWhenInitHandleInternal);
+	ViewportResizedWhenInitHandleInternal.Reset();
+
+	ConstructSettings();
+}
+
+// Is called on every viewport resize to schedule the relayout of constructed settings on next tick
+void USettingsWidget::OnViewportResized(FViewport* Viewport, uint32 Index)
+{
+	const UWorld* World = GetWorld();
+	if (bIsRelayoutPendingInternal
+		|| !World
+		|| !IsSettingsWidgetConstructed())
 	{
-		FViewport::ViewportResizedEvent.RemoveAll(this);
+		return;
 	}
 
-	ConstructSettings();
+	// Dragging a window edge fires many resizes per frame, so relayout only once on next tick
+	bIsRelayoutPendingInternal = true;
+	World->GetTimerManager().SetTimerForNextTick(this, &ThisClass::RelayoutSettings);
+}
+
+// Is called when DPI scale of any window was changed to schedule the relayout of constructed settings on next tick
+void USettingsWidget::OnWindowDPIScaleChanged(TSharedRef<SWindow> Window)
+{
+	OnViewportResized(nullptr, 0);
+}
+
+// Recalculates only size-dependent values of already constructed settings
+void USettingsWidget::RelayoutSettings()
+{
+	bIsRelayoutPendingInternal = false;
+
+	if (!IsSettingsWidgetConstructed())
+	{
+		return;
+	}
+
+	if (bIsSectionsHeightDirtyInternal)
+	{
+		// Some rows were measured with another height than estimated
+		UpdateSectionsHeight();
+	}
+
+	// Is cheap when the viewport size and scale are the same since the scrollbox height is cached by them
+	if (GetScrollBoxHeight() != AppliedScrollBoxHeightInternal)
+	{
+		UpdateScrollBoxesHeight();
+	}
 }
 
 // Construct all settings from the settings data table
@@ -742,47 +480,50 @@ void USettingsWidget::ConstructSettings()
 		return;
 	}
 
-	UpdateSettingsTableRows();
+	USettingsSubsystem* SettingsSubsystem = GetSettingsSubsystem();
+	if (!ensureMsgf(SettingsSubsystem, TEXT("ASSERT: 'SettingsSubsystem' is not valid")))
+	{
+		return;
+	}
+
+	if (!SettingsSubsystem->GetSettingsTableRowsNum())
+	{
+		UpdateSettingsTableRows();
+	}
+	else
+	{
+		UpdateSectionsHeight();
+	}
 
 	// BP implementation to cache some data before creating subwidgets
 	OnConstructSettings();
 
-	for (TTuple<FName, FSettingsPicker>& RowIt : SettingsTableRowsInternal)
+	// Static Context objects like player controller might not exist when the subsystem was initialized
+	SettingsSubsystem->BindSettings();
+
+	for (const TTuple<FName, FSettingsPicker>& RowIt : SettingsSubsystem->GetSettingsTableRows())
 	{
-		AddSetting(RowIt.Value);
+		// The row is copied, since the view never changes the subsystem directly
+		FSettingsPicker Setting = RowIt.Value;
+		AddSetting(Setting);
 	}
 
+	// Rows that might be higher than their Line Height are estimated until their sub-widgets are laid out and report real heights
 	UpdateScrollBoxesHeight();
 }
 
+// Internal function to cache setting rows from Settings Data Table in the Settings Subsystem and to recalculate sections by them
 void USettingsWidget::UpdateSettingsTableRows()
 {
-	const USettingsDataTable* SettingsDataTable = USettingsDataAsset::Get().GetSettingsDataTable();
-	if (!ensureMsgf(SettingsDataTable, TEXT("ASSERT: 'SettingsDataTable' is not valid")))
+	USettingsSubsystem* SettingsSubsystem = GetSettingsSubsystem();
+	if (!ensureMsgf(SettingsSubsystem, TEXT("ASSERT: 'SettingsSubsystem' is not valid")))
 	{
 		return;
 	}
 
-	TMap<FName, FSettingsRow> SettingRows;
-	SettingsDataTable->GetSettingRows(/*Out*/SettingRows);
-	if (!ensureMsgf(!SettingRows.IsEmpty(), TEXT("ASSERT: 'SettingRows' are empty")))
-	{
-		return;
-	}
+	SettingsSubsystem->UpdateSettingsTableRows();
 
-	// Reset values if currently are set
-	OverallColumnsNumInternal = 1;
-	SettingsTableRowsInternal.Empty();
-
-	SettingsTableRowsInternal.Reserve(SettingRows.Num());
-	for (const TTuple<FName, FSettingsRow>& SettingRowIt : SettingRows)
-	{
-		const FSettingsPicker& SettingsPicker = SettingRowIt.Value.SettingsPicker;
-		SettingsTableRowsInternal.Emplace(SettingRowIt.Key, SettingsPicker);
-
-		// Set overall columns num by amount of rows that are marked to be started on next column
-		OverallColumnsNumInternal += static_cast<int32>(SettingsPicker.PrimaryData.bStartOnNextColumn);
-	}
+	UpdateSectionsHeight();
 }
 
 // Is called when In-Game menu became opened or closed
@@ -796,46 +537,94 @@ void USettingsWidget::OnToggleSettings(bool bIsVisible)
 	}
 }
 
-// Bind and set static object delegate
-void USettingsWidget::TryBindStaticContext(FSettingsPrimary& Primary)
+// Is called when the value of any setting was changed in the Settings Subsystem to show it on UI
+void USettingsWidget::OnSettingChanged(const FSettingTag& SettingTag)
 {
-	UObject* FoundContextObj = nullptr;
-	if (UFunction* FunctionPtr = Primary.StaticContext.GetFunction())
+	USettingSubWidget* SettingSubWidget = GetSettingSubWidget(SettingTag);
+	if (!SettingSubWidget)
 	{
-		FunctionPtr->ProcessEvent(FunctionPtr, /*Out*/&FoundContextObj);
+		// The setting is not shown on this widget
+		return;
 	}
 
-	if (!FoundContextObj)
+	const FSettingsPicker& Setting = GetSettingRow(SettingTag);
+	const FSettingsDataBase* ChosenData = Setting.GetChosenSettingsData();
+	if (!ChosenData)
 	{
 		return;
 	}
 
-	Primary.StaticContextObject = FoundContextObj;
-
-	const UClass* ContextClass = FoundContextObj->GetClass();
-	if (!ensureMsgf(ContextClass, TEXT("ASSERT: 'ContextClass' is not valid")))
+	if (ChosenData == &Setting.Button)
 	{
-		return;
+		PlayUIClickSFX();
 	}
-
-	// Cache all functions that are contained in returned object
-	for (TFieldIterator<UFunction> It(ContextClass, EFieldIteratorFlags::IncludeSuper); It; ++It)
+	else if (ChosenData == &Setting.Checkbox)
+	{
+		// BP implementation
+		SetCheckbox(SettingTag, Setting.Checkbox.bIsSet);
+		PlayUIClickSFX();
+	}
+	else if (ChosenData == &Setting.Combobox)
+	{
+		// BP implementation
+		SetComboboxIndex(SettingTag, Setting.Combobox.ChosenMemberIndex);
+	}
+	else if (ChosenData == &Setting.Slider)
+	{
+		// BP implementation
+		SetSlider(SettingTag, Setting.Slider.ChosenValue);
+	}
+	else if (ChosenData == &Setting.TextLine)
+	{
+		SettingSubWidget->SetCaptionText(Setting.PrimaryData.Caption);
+	}
+	else if (ChosenData == &Setting.UserInput)
 	{
-		const UFunction* FunctionIt = *It;
-		if (!FunctionIt)
+		const FSettingsUserInput& UserInput = Setting.UserInput;
+		USettingUserInput* SettingUserInput = Cast<USettingUserInput>(SettingSubWidget);
+		if (SettingUserInput
+			&& UserInput.MaxCharactersNumber > 0)
 		{
-			continue;
+			// Show the value limited by the subsystem
+			SettingUserInput->SetEditableText(FText::FromName(UserInput.UserInput));
 		}
 
-		const FName FunctionNameIt = FunctionIt->GetFName();
-		if (!FunctionNameIt.IsNone())
-		{
-			Primary.StaticContextFunctionList.Emplace(FunctionNameIt);
-		}
+		// BP implementation
+		SetUserInput(SettingTag, UserInput.UserInput);
+		PlayUIClickSFX();
 	}
 }
 
-// Creates new widget based on specified setting class and sets it to specified primary data
+// Is called when members of any combobox were changed in the Settings Subsystem to show them on UI
+void USettingsWidget::OnComboboxMembersChanged(const FSettingTag& SettingTag)
+{
+	if (!GetSettingSubWidget(SettingTag))
+	{
+		// The setting is not shown on this widget
+		return;
+	}
+
+	// BP implementation
+	SetComboboxMembers(SettingTag, GetSettingRow(SettingTag).Combobox.Members);
+}
+
+// Is called when the async getter of any setting was started or finished in the Settings Subsystem
+void USettingsWidget::OnSettingLoadingChanged(const FSettingTag& SettingTag, bool bIsLoading)
+{
+	USettingSubWidget* SettingSubWidget = GetSettingSubWidget(SettingTag);
+	if (!SettingSubWidget)
+	{
+		// The setting is not shown on this widget
+		return;
+	}
+
+	SettingSubWidget->SetIsEnabled(!bIsLoading);
+
+	// BP implementation
+	SetSettingLoading(SettingTag, bIsLoading);
+}
+
+// Creates new widget based on specified setting class and registers it by the tag of specified primary data
 USettingSubWidget* USettingsWidget::CreateSettingSubWidget(FSettingsPrimary& InOutPrimary, const TSubclassOf<USettingSubWidget> SettingSubWidgetClass)
 {
 	if (!SettingSubWidgetClass)
@@ -844,7 +633,10 @@ USettingSubWidget* USettingsWidget::CreateSettingSubWidget(FSettingsPrimary& InO
 	}
 
 	USettingSubWidget* SettingSubWidget = CreateWidget<USettingSubWidget>(this, SettingSubWidgetClass);
-	InOutPrimary.SettingSubWidget = SettingSubWidget;
+	if (InOutPrimary.Tag.IsValid())
+	{
+		SettingSubWidgetsInternal.Emplace(InOutPrimary.Tag.GetTagName(), SettingSubWidget);
+	}
 	SettingSubWidget->SetSettingsWidget(this);
 	SettingSubWidget->SetSettingPrimaryRow(InOutPrimary);
 	SettingSubWidget->SetLineHeight(InOutPrimary.LineHeight);
@@ -860,11 +652,125 @@ void USettingsWidget::StartNextColumn_Implementation()
 	// ...
 }
 
+// Calculates amount of columns and heights of all sections by Line Height and Padding of their rows
+void USettingsWidget::UpdateSectionsHeight()
+{
+	const USettingsSubsystem* SettingsSubsystem = GetSettingsSubsystem();
+	if (!SettingsSubsystem)
+	{
+		return;
+	}
+
+	OverallColumnsNumInternal = 1;
+	HeaderHeightInternal = 0.f;
+	FooterHeightInternal = 0.f;
+	ContentHeightInternal = 0.f;
+	float ColumnHeight = 0.f;
+
+	for (const TTuple<FName, FSettingsPicker>& RowIt : SettingsSubsystem->GetSettingsTableRows())
+	{
+		const FSettingsPicker& Setting = RowIt.Value;
+		const FSettingsPrimary& PrimaryData = Setting.PrimaryData;
+
+		// Set overall columns num by amount of rows that are marked to be started on next column
+		OverallColumnsNumInternal += static_cast<int32>(PrimaryData.bStartOnNextColumn);
+
+		if (!Setting.GetChosenSettingsData())
+		{
+			continue;
+		}
+
+		const float RowHeight = GetSettingRowHeight(Setting) + PrimaryData.Padding.Top + PrimaryData.Padding.Bottom;
+
+		switch (Setting.GetVerticalAlignment())
+		{
+		case EMyVerticalAlignment::Header:
+			HeaderHeightInternal += RowHeight;
+			break;
+		case EMyVerticalAlignment::Footer:
+			FooterHeightInternal += RowHeight;
+			break;
+		default:
+			if (PrimaryData.bStartOnNextColumn)
+			{
+				ColumnHeight = 0.f;
+			}
+			ColumnHeight += RowHeight;
+			ContentHeightInternal = FMath::Max(ContentHeightInternal, ColumnHeight);
+			break;
+		}
+	}
+
+	// Sections are changed, so the scrollbox height has to be recalculated
+	CachedScrollBoxHeightInternal = INDEX_NONE;
+	bIsSectionsHeightDirtyInternal = false;
+}
+
+// Returns the height of specified setting row without its padding
+float USettingsWidget::GetSettingRowHeight(const FSettingsPicker& Setting) const
+{
+	const FSettingsPrimary& PrimaryData = Setting.PrimaryData;
+	const FSettingsDataBase* ChosenData = Setting.GetChosenSettingsData();
+	const bool bIsFixedHeight = ChosenData != &Setting.TextLine
+		&& ChosenData != &Setting.CustomWidget;
+	if (bIsFixedHeight)
+	{
+		return PrimaryData.LineHeight;
+	}
+
+	// Line Height is only the minimal height of the row, so take the real height if the sub-widget was already laid out
+	if (const float* MeasuredHeight = MeasuredRowHeightsInternal.Find(PrimaryData.Tag.GetTagName()))
+	{
+		return FMath::Max(PrimaryData.LineHeight, *MeasuredHeight);
+	}
+
+	if (ChosenData == &Setting.CustomWidget)
+	{
+		return FMath::Max(PrimaryData.LineHeight, Setting.CustomWidget.DesiredHeight);
+	}
+
+	// Estimate the text line by the height of its font, the text might be wrapped additionally, but it will be measured after the layout
+	if (!FSlateApplication::IsInitialized())
+	{
+		return PrimaryData.LineHeight;
+	}
+
+	const FSlateFontInfo& Font = USettingsDataAsset::Get().GetMiscThemeData().TextAndCaptionFont;
+	const TSharedRef<FSlateFontMeasure> FontMeasure = FSlateApplication::Get().GetRenderer()->GetFontMeasureService();
+	TArray<FString> Lines;
+	const int32 LinesNum = FMath::Max(1, PrimaryData.Caption.ToString().ParseIntoArrayLines(Lines, /*bCullEmpty*/false));
+	return FMath::Max(PrimaryData.LineHeight, LinesNum * static_cast<float>(FontMeasure->GetMaxCharacterHeight(Font)));
+}
+
+// Is called by the sub-widget of specified setting after it was laid out with a new height
+void USettingsWidget::OnSettingRowHeightMeasured(const FSettingTag& SettingTag, float MeasuredHeight)
+{
+	const float* LastHeight = MeasuredRowHeightsInternal.Find(SettingTag.GetTagName());
+	if (LastHeight
+		&& FMath::IsNearlyEqual(*LastHeight, MeasuredHeight))
+	{
+		return;
+	}
+
+	MeasuredRowHeightsInternal.Add(SettingTag.GetTagName(), MeasuredHeight);
+	bIsSectionsHeightDirtyInternal = true;
+
+	const UWorld* World = GetWorld();
+	if (bIsRelayoutPendingInternal
+		|| !World)
+	{
+		return;
+	}
+
+	bIsRelayoutPendingInternal = true;
+	World->GetTimerManager().SetTimerForNextTick(this, &ThisClass::RelayoutSettings);
+}
+
 // Automatically sets the height for all scrollboxes in the Settings
 void USettingsWidget::UpdateScrollBoxesHeight()
 {
-	ForceLayoutPrepass(); // Call it to make GetSettingsHeight work since it is called during widget construction
 	const float ScrollBoxHeight = GetScrollBoxHeight();
+	AppliedScrollBoxHeightInternal = ScrollBoxHeight;
 
 	for (const USettingScrollBox* ScrollBoxIt : SettingScrollBoxesInternal)
 	{
@@ -904,9 +810,9 @@ void USettingsWidget::TryConstructSettings()
 	{
 		ConstructSettings();
 	}
-	else if (!FViewport::ViewportResizedEvent.IsBoundToObject(this))
+	else if (!ViewportResizedWhenInitHandleInternal.IsValid())
 	{
-		FViewport::ViewportResizedEvent.AddUObject(this, &ThisClass::OnViewportResizedWhenInit);
+		ViewportResizedWhenInitHandleInternal = FViewport::ViewportResizedEvent.AddUObject(this, &ThisClass::OnViewportResizedWhenInit);
 	}
 }
 
@@ -921,6 +827,12 @@ void USettingsWidget::OpenSettings()
 
 	TryConstructSettings();
 
+	if (USettingsSubsystem* SettingsSubsystem = GetSettingsSubsystem())
+	{
+		// Settings might be changed by the game while the widget was closed
+		SettingsSubsystem->RefreshStaleSettings();
+	}
+
 	SetVisibility(ESlateVisibility::Visible);
 
 	OnToggleSettings(true);
@@ -970,7 +882,6 @@ void USettingsWidget::AddSetting(FSettingsPicker& Setting)
 	}
 
 	FSettingsPrimary& PrimaryData = Setting.PrimaryData;
-	TryBindStaticContext(PrimaryData);
 
 	if (Setting.PrimaryData.bStartOnNextColumn)
 	{
@@ -1005,8 +916,6 @@ void USettingsWidget::AddSetting(FSettingsPicker& Setting)
 	{
 		AddSettingCustomWidget(PrimaryData, Setting.CustomWidget);
 	}
-
-	UpdateSettings(FGameplayTagContainer(PrimaryData.Tag));
 }
 
 // Add button on UI
@@ -1015,15 +924,6 @@ void USettingsWidget::AddSettingButton(FSettingsPrimary& Primary, FSettingsButto
 	const TSubclassOf<USettingButton> ButtonClass = USettingsDataAsset::Get().GetButtonClass();
 	CreateSettingSubWidget(Primary, ButtonClass);
 
-	if (UObject* StaticContextObject = Primary.StaticContextObject.Get())
-	{
-		const FName SetterFunctionName = Primary.Setter.FunctionName;
-		if (Primary.StaticContextFunctionList.Contains(SetterFunctionName))
-		{
-			Data.OnButtonPressed.BindUFunction(StaticContextObject, SetterFunctionName);
-		}
-	}
-
 	AddButton(Primary, Data);
 }
 
@@ -1033,21 +933,6 @@ void USettingsWidget::AddSettingCheckbox(FSettingsPrimary& Primary, FSettingsChe
 	const TSubclassOf<USettingCheckbox> CheckboxClass = USettingsDataAsset::Get().GetCheckboxClass();
 	CreateSettingSubWidget(Primary, CheckboxClass);
 
-	if (UObject* StaticContextObject = Primary.StaticContextObject.Get())
-	{
-		const FName GetterFunctionName = Primary.Getter.FunctionName;
-		if (Primary.StaticContextFunctionList.Contains(GetterFunctionName))
-		{
-			Data.OnGetterBool.BindUFunction(StaticContextObject, GetterFunctionName);
-		}
-
-		const FName SetterFunctionName = Primary.Setter.FunctionName;
-		if (Primary.StaticContextFunctionList.Contains(SetterFunctionName))
-		{
-			Data.OnSetterBool.BindUFunction(StaticContextObject, SetterFunctionName);
-		}
-	}
-
 	AddCheckbox(Primary, Data);
 }
 
@@ -1057,36 +942,15 @@ void USettingsWidget::AddSettingCombobox(FSettingsPrimary& Primary, FSettingsCom
 	const TSubclassOf<USettingCombobox> ComboboxClass = USettingsDataAsset::Get().GetComboboxClass();
 	CreateSettingSubWidget(Primary, ComboboxClass);
 
-	if (UObject* StaticContextObject = Primary.StaticContextObject.Get())
-	{
-		const FName GetMembersFunctionName = Data.GetMembers.FunctionName;
-		if (Primary.StaticContextFunctionList.Contains(GetMembersFunctionName))
-		{
-			Data.OnGetMembers.BindUFunction(StaticContextObject, GetMembersFunctionName);
-			Data.OnGetMembers.ExecuteIfBound(Data.Members);
-		}
-
-		const FName SetMembersFunctionName = Data.SetMembers.FunctionName;
-		if (Primary.StaticContextFunctionList.Contains(SetMembersFunctionName))
-		{
-			Data.OnSetMembers.BindUFunction(StaticContextObject, SetMembersFunctionName);
-			Data.OnSetMembers.ExecuteIfBound(Data.Members);
-		}
-
-		const FName GetterFunctionName = Primary.Getter.FunctionName;
-		if (Primary.StaticContextFunctionList.Contains(GetterFunctionName))
-		{
-			Data.OnGetterInt.BindUFunction(StaticContextObject, GetterFunctionName);
-		}
+	AddCombobox(Primary, Data);
 
-		const FName SetterFunctionName = Primary.Setter.FunctionName;
-		if (Primary.StaticContextFunctionList.Contains(SetterFunctionName))
-		{
-			Data.OnSetterInt.BindUFunction(StaticContextObject, SetterFunctionName);
-		}
+	const USettingsSubsystem* SettingsSubsystem = GetSettingsSubsystem();
+	if (SettingsSubsystem
+		&& SettingsSubsystem->IsSettingLoading(Primary.Tag))
+	{
+		// Members are still loading in background
+		OnSettingLoadingChanged(Primary.Tag, true);
 	}
-
-	AddCombobox(Primary, Data);
 }
 
 // Add slider on UI
@@ -1095,21 +959,6 @@ void USettingsWidget::AddSettingSlider(FSettingsPrimary& Primary, FSettingsSlide
 	const TSubclassOf<USettingSlider>& SliderClass = USettingsDataAsset::Get().GetSliderClass();
 	CreateSettingSubWidget(Primary, SliderClass);
 
-	if (UObject* StaticContextObject = Primary.StaticContextObject.Get())
-	{
-		const FName GetterFunctionName = Primary.Getter.FunctionName;
-		if (Primary.StaticContextFunctionList.Contains(GetterFunctionName))
-		{
-			Data.OnGetterFloat.BindUFunction(StaticContextObject, GetterFunctionName);
-		}
-
-		const FName SetterFunctionName = Primary.Setter.FunctionName;
-		if (Primary.StaticContextFunctionList.Contains(SetterFunctionName))
-		{
-			Data.OnSetterFloat.BindUFunction(StaticContextObject, SetterFunctionName);
-		}
-	}
-
 	AddSlider(Primary, Data);
 }
 
@@ -1119,21 +968,6 @@ void USettingsWidget::AddSettingTextLine(FSettingsPrimary& Primary, FSettingsTex
 	const TSubclassOf<USettingTextLine>& TextLineClass = USettingsDataAsset::Get().GetTextLineClass();
 	CreateSettingSubWidget(Primary, TextLineClass);
 
-	if (UObject* StaticContextObject = Primary.StaticContextObject.Get())
-	{
-		const FName GetterFunctionName = Primary.Getter.FunctionName;
-		if (Primary.StaticContextFunctionList.Contains(GetterFunctionName))
-		{
-			Data.OnGetterText.BindUFunction(StaticContextObject, GetterFunctionName);
-		}
-
-		const FName SetterFunctionName = Primary.Setter.FunctionName;
-		if (Primary.StaticContextFunctionList.Contains(SetterFunctionName))
-		{
-			Data.OnSetterText.BindUFunction(StaticContextObject, SetterFunctionName);
-		}
-	}
-
 	AddTextLine(Primary, Data);
 }
 
@@ -1143,43 +977,13 @@ void USettingsWidget::AddSettingUserInput(FSettingsPrimary& Primary, FSettingsUs
 	const TSubclassOf<USettingUserInput>& UserInputClass = USettingsDataAsset::Get().GetUserInputClass();
 	CreateSettingSubWidget(Primary, UserInputClass);
 
-	if (UObject* StaticContextObject = Primary.StaticContextObject.Get())
-	{
-		const FName GetterFunctionName = Primary.Getter.FunctionName;
-		if (Primary.StaticContextFunctionList.Contains(GetterFunctionName))
-		{
-			Data.OnGetterName.BindUFunction(StaticContextObject, GetterFunctionName);
-		}
-
-		const FName SetterFunctionName = Primary.Setter.FunctionName;
-		if (Primary.StaticContextFunctionList.Contains(SetterFunctionName))
-		{
-			Data.OnSetterName.BindUFunction(StaticContextObject, SetterFunctionName);
-		}
-	}
-
 	AddUserInput(Primary, Data);
 }
 
 // Add custom widget on UI
 void USettingsWidget::AddSettingCustomWidget(FSettingsPrimary& Primary, FSettingsCustomWidget& Data)
 {
-	CreateSettingSubWidget(Primary, Data.CustomWidgetClass);
-
-	if (UObject* StaticContextObject = Primary.StaticContextObject.Get())
-	{
-		const FName GetterFunctionName = Primary.Getter.FunctionName;
-		if (Primary.StaticContextFunctionList.Contains(GetterFunctionName))
-		{
-			Data.OnGetterWidget.BindUFunction(StaticContextObject, GetterFunctionName);
-		}
-
-		const FName SetterFunctionName = Primary.Setter.FunctionName;
-		if (Primary.StaticContextFunctionList.Contains(SetterFunctionName))
-		{
-			Data.OnSetterWidget.BindUFunction(StaticContextObject, SetterFunctionName);
-		}
-	}
+	CreateSettingSubWidget(Primary, TSubclassOf<USettingSubWidget>(Data.CustomWidgetClass.Get()));
 
 	AddCustomWidget(Primary, Data);
 }
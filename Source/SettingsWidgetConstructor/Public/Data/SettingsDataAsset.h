@@ -4,7 +4,7 @@
 
 #include "Engine/DeveloperSettings.h"
 //---
-#include "Data/SettingsDataTable.h"
+#include "Data/SettingsCoreDataAsset.h"
 #include "Data/SettingsThemeData.h"
 //---
 #include "SettingsDataAsset.generated.h"
@@ -32,9 +32,10 @@ public:
 	/** Gets the category for the settings, some high level grouping like, Editor, Engine, Game...etc. */
 	virtual FName GetCategoryName() const override { return TEXT("Plugins"); }
 
-	/** Returns the data table. */
+	/** Returns the data table, is stored in the core settings.
+	 * @see USettingsCoreDataAsset::SettingsDataTableInternal */
 	UFUNCTION(BlueprintPure, Category = "Settings Widget Constructor")
-	FORCEINLINE USettingsDataTable* GetSettingsDataTable() const { return SettingsDataTableInternal.LoadSynchronous(); }
+	FORCEINLINE USettingsDataTable* GetSettingsDataTable() const { return USettingsCoreDataAsset::Get().GetSettingsDataTable(); }
 
 	/** Returns the sub-widget of Button settings. */
 	UFUNCTION(BlueprintPure, Category = "Settings Widget Constructor")
@@ -108,11 +109,41 @@ public:
 	UFUNCTION(BlueprintPure, Category = "Settings Widget Constructor")
 	const FORCEINLINE FMiscThemeData& GetMiscThemeData() const { return MiscThemeDataInternal; }
 
-protected:
-	/** The data table with all settings, is config property. */
-	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Config, Category = "Settings Widget Constructor", meta = (BlueprintProtected, DisplayName = "Settings Data Table", ShowOnlyInnerProperties))
-	TSoftObjectPtr<class USettingsDataTable> SettingsDataTableInternal;
+	/** Returns the cached style brush of the button by specified state. */
+	UFUNCTION(BlueprintPure, Category = "Settings Widget Constructor|Style")
+	const FSlateBrush& GetButtonBrush(ESettingsButtonState State) const;
+
+	/** Returns the cached style brush of the checkbox by specified state. */
+	UFUNCTION(BlueprintPure, Category = "Settings Widget Constructor|Style")
+	const FSlateBrush& GetCheckboxBrush(ESettingsCheckboxState State) const;
+
+	/** Returns the cached style brush of the combobox by specified state. */
+	UFUNCTION(BlueprintPure, Category = "Settings Widget Constructor|Style")
+	const FSlateBrush& GetComboboxBrush(ESettingsButtonState State) const;
+
+	/** Returns the cached style brush of the combobox arrow. */
+	UFUNCTION(BlueprintPure, Category = "Settings Widget Constructor|Style")
+	const FORCEINLINE FSlateBrush& GetComboboxArrowBrush() const { return GetThemeBrushes().ComboboxArrow; }
+
+	/** Returns the cached style brush of the combobox border. */
+	UFUNCTION(BlueprintPure, Category = "Settings Widget Constructor|Style")
+	const FORCEINLINE FSlateBrush& GetComboboxBorderBrush() const { return GetThemeBrushes().ComboboxBorder; }
+
+	/** Returns the cached style brush of the slider by specified state. */
+	UFUNCTION(BlueprintPure, Category = "Settings Widget Constructor|Style")
+	const FSlateBrush& GetSliderBrush(ESettingsSliderState State) const;
+
+	/** Returns the cached style brush of the tooltip background. */
+	UFUNCTION(BlueprintPure, Category = "Settings Widget Constructor|Style")
+	const FORCEINLINE FSlateBrush& GetTooltipBrush() const { return GetThemeBrushes().Tooltip; }
 
+	/** Returns all style brushes, bakes them from theme data on first call. */
+	const FSettingsThemeBrushes& GetThemeBrushes() const;
+
+	/** Marks all baked style brushes as outdated, so they will be baked again on next request. */
+	void InvalidateThemeBrushes() const;
+
+protected:
 	/** The sub-widget class of Button settings, is config property. */
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Config, Category = "Settings Widget Constructor", meta = (BlueprintProtected, DisplayName = "Button Class", ShowOnlyInnerProperties))
 	TSubclassOf<class USettingButton> ButtonClassInternal;
@@ -184,4 +215,15 @@ protected:
 	/** The misc theme data, is config property. */
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Config, Category = "Settings Widget Constructor", meta = (BlueprintProtected, DisplayName = "Misc Theme Data"))
 	FMiscThemeData MiscThemeDataInternal;
+
+	/** All style brushes baked from theme data, is not config property. */
+	mutable FSettingsThemeBrushes ThemeBrushesInternal;
+
+	/** Is called when config was reloaded to rebake all brushes. */
+	virtual void PostReloadConfig(FProperty* PropertyThatWasLoaded) override;
+
+#if WITH_EDITOR
+	/** Is called when any theme data was changed in editor to rebake all brushes. */
+	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+#endif // WITH_EDITOR
 };
@@ -3,6 +3,9 @@
 #pragma once
 
 #include "Components/SlateWrapperTypes.h"
+#include "Styling/SlateBrush.h"
+//---
+#include "Data/SettingTypes.h"
 //---
 #include "SettingsThemeData.generated.h"
 
@@ -13,7 +16,8 @@
 *	╠════FCheckboxThemeData
 *	╠════FComboboxThemeData
 *	╠════FSliderThemeData
-*	╚════FMiscThemeData
+*	╠════FMiscThemeData
+*	╚════FSettingsThemeBrushes (baked from all above)
 */
 
 /**
@@ -43,6 +47,11 @@ struct SETTINGSWIDGETCONSTRUCTOR_API FSettingsThemeData
 	/** Outside padding of the image. */
 	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite)
 	FMargin Padding;
+
+	/** Creates the style brush from this theme data.
+	  * @param TintColor The color to tint the image.
+	  * @param OverrideTexture If set, is drawn instead of the Texture of this theme data. */
+	FSlateBrush MakeBrush(const FSlateColor& TintColor, UTexture* OverrideTexture = nullptr) const;
 };
 
 /**
@@ -209,3 +218,44 @@ struct SETTINGSWIDGETCONSTRUCTOR_API FMiscThemeData
 	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite)
 	ESlateVisibility MenuBorderVisibility = ESlateVisibility::Visible;
 };
+
+/**
+  * All style brushes of settings by their states.
+  * Is baked once from theme data by USettingsDataAsset and is rebuilt only when the theme is changed,
+  * so UI does not construct new brushes on every hover and press.
+  * @see USettingsDataAsset::GetButtonBrush
+  */
+struct SETTINGSWIDGETCONSTRUCTOR_API FSettingsThemeBrushes
+{
+	/** The amount of states by each setting type. */
+	static constexpr int32 ButtonStatesNum = static_cast<int32>(ESettingsButtonState::Disabled) + 1;
+	static constexpr int32 CheckboxStatesNum = static_cast<int32>(ESettingsCheckboxState::UndeterminedPressed) + 1;
+	static constexpr int32 SliderStatesNum = static_cast<int32>(ESettingsSliderState::HoveredThumb) + 1;
+
+	/** Brushes of the button by ESettingsButtonState. */
+	FSlateBrush Button[ButtonStatesNum];
+
+	/** Brushes of the checkbox by ESettingsCheckboxState. */
+	FSlateBrush Checkbox[CheckboxStatesNum];
+
+	/** Brushes of the combobox by ESettingsButtonState. */
+	FSlateBrush Combobox[ButtonStatesNum];
+
+	/** Brush of the combobox arrow. */
+	FSlateBrush ComboboxArrow;
+
+	/** Brush of the combobox border. */
+	FSlateBrush ComboboxBorder;
+
+	/** Brushes of the slider by ESettingsSliderState. */
+	FSlateBrush Slider[SliderStatesNum];
+
+	/** Brush of the tooltip background. */
+	FSlateBrush Tooltip;
+
+	/** Is true when all brushes are baked and can be used. */
+	bool bIsBaked = false;
+
+	/** Creates all brushes by specified theme data. */
+	void Bake(const FButtonThemeData& ButtonThemeData, const FCheckboxThemeData& CheckboxThemeData, const FComboboxThemeData& ComboboxThemeData, const FSliderThemeData& SliderThemeData, const FMiscThemeData& MiscThemeData);
+};
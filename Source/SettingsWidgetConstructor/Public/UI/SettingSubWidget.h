@@ -79,6 +79,14 @@ protected:
 	/** The main settings widget. */
 	UPROPERTY(VisibleInstanceOnly, BlueprintReadWrite, Transient, Category = "Settings Widget Constructor|Sub-Widget", meta = (BlueprintProtected, DisplayName = "Settings Widget"))
 	TObjectPtr<class USettingsWidget> SettingsWidgetInternal = nullptr;
+
+	/** The last height of this sub-widget that was reported to the main settings widget.
+	 * @see USettingSubWidget::ReportMeasuredHeight */
+	float MeasuredHeightInternal = 0.f;
+
+	/** Reports the height of this sub-widget to the main settings widget once it was laid out with a new height,
+	 * is used by sub-widgets that might be higher than their Line Height. */
+	void ReportMeasuredHeight();
 };
 
 /**
@@ -246,7 +254,9 @@ class SETTINGSWIDGETCONSTRUCTOR_API USettingTextLine : public USettingSubWidget
 {
 	GENERATED_BODY()
 
-public:
+protected:
+	/** Is executed every tick when widget is enabled, reports the height once the text was laid out. */
+	virtual void NativeTick(const FGeometry& MyGeometry, float InDeltaTime) override;
 };
 
 /**
@@ -299,7 +309,9 @@ class SETTINGSWIDGETCONSTRUCTOR_API USettingCustomWidget : public USettingSubWid
 {
 	GENERATED_BODY()
 
-public:
+protected:
+	/** Is executed every tick when widget is enabled, reports the height once the widget was laid out. */
+	virtual void NativeTick(const FGeometry& MyGeometry, float InDeltaTime) override;
 };
 
 /**
@@ -10,7 +10,9 @@
 
 /**
  * The UI widget of settings.
- * It generates and manages settings specified in rows of the Settings Data Table.
+ * It generates sub-widgets for settings specified in rows of the Settings Data Table and shows their values.
+ * Is only a view: values, bindings and persistence are owned by the Settings Subsystem, so it forwards all changes to it.
+ * @see USettingsSubsystem
  */
 UCLASS(Abstract, Blueprintable, BlueprintType)
 class SETTINGSWIDGETCONSTRUCTOR_API USettingsWidget : public UUserWidget
@@ -58,19 +60,23 @@ public:
 
 	/** Returns true when this widget is fully constructed and ready to be used. */
 	UFUNCTION(BlueprintPure, Category = "C++")
-	FORCEINLINE bool IsSettingsWidgetConstructed() const { return SettingsTableRowsInternal.Num() > 0; }
+	FORCEINLINE bool IsSettingsWidgetConstructed() const { return SettingSubWidgetsInternal.Num() > 0; }
 
 	/** Is called to player sound effect on any setting click. */
 	UFUNCTION(BlueprintImplementableEvent, Category = "Settings Widget Constructor")
 	void PlayUIClickSFX();
 
+	/** Returns the subsystem that owns all settings shown by this widget, is null if there is no game instance. */
+	UFUNCTION(BlueprintPure, Category = "Settings Widget Constructor")
+	class USettingsSubsystem* GetSettingsSubsystem() const;
+
 	/** Returns the amount of settings rows. */
 	UFUNCTION(BlueprintPure, Category = "Settings Widget Constructor")
-	FORCEINLINE int32 GetSettingsTableRowsNum() const { return SettingsTableRowsInternal.Num(); }
+	int32 GetSettingsTableRowsNum() const;
 
 	/** Try to find the setting row.
 	* @param PotentialTagName The probable tag name by which the row will be found (for 'VSync' will find a row with 'Settings.Checkbox.VSync' tag).
-	* @see UMyGameUserSettings::SettingsTableRowsInternal */
+	* @see USettingsSubsystem::FindSettingRow */
 	UFUNCTION(BlueprintPure, Category = "Settings Widget Constructor")
 	const FSettingsPicker& FindSettingRow(FName PotentialTagName) const;
 
@@ -87,12 +93,32 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Settings Widget Constructor")
 	void ApplySettings();
 
+	/** Calls real setters of all staged values in one batch, e.g: on 'Apply' button.
+	 * @see USettingsSubsystem::IsStageChanges */
+	UFUNCTION(BlueprintCallable, Category = "Settings Widget Constructor")
+	void ApplyPendingSettings();
+
+	/** Discards all staged values and shows current values again, e.g: on 'Revert' button. */
+	UFUNCTION(BlueprintCallable, Category = "Settings Widget Constructor")
+	void RevertPendingSettings();
+
 	/** Update settings on UI.
 	 * @param SettingsToUpdate Contains tags of settings that are needed to update. */
 	UFUNCTION(BlueprintCallable, Category = "Settings Widget Constructor", meta = (AutoCreateRefTerm = "SettingsToUpdate"))
 	void UpdateSettings(
 		UPARAM(meta = (Categories = "Settings")) const FGameplayTagContainer& SettingsToUpdate);
 
+	/** Marks cached getter results of specified settings as outdated, so their getters will be called again on next request.
+	 * Call it when the game has changed settings outside of the Settings Widget.
+	 * @param SettingsToInvalidate Contains tags of settings which getters are needed to call again. */
+	UFUNCTION(BlueprintCallable, Category = "Settings Widget Constructor", meta = (AutoCreateRefTerm = "SettingsToInvalidate"))
+	void InvalidateSettingsCache(
+		UPARAM(meta = (Categories = "Settings")) const FGameplayTagContainer& SettingsToInvalidate);
+
+	/** Marks cached getter results of all settings as outdated, so all getters will be called again on next request. */
+	UFUNCTION(BlueprintCallable, Category = "Settings Widget Constructor")
+	void InvalidateAllSettingsCache();
+
 	/** Returns the name of found tag by specified function. */
 	UFUNCTION(BlueprintPure, Category = "Settings Widget Constructor", meta = (AutoCreateRefTerm = "SettingFunction"))
 	const FSettingTag& GetTagByFunction(const FSettingFunctionPicker& SettingFunction) const;
@@ -105,18 +131,26 @@ public:
 	UFUNCTION(BlueprintPure, Category = "Settings Widget Constructor")
 	FVector2D GetSettingsSize() const;
 
-	/** Returns the size of specified sections on the screen. */
+	/** Returns the size of specified sections on the screen.
+	 * The height is calculated from heights of settings rows in these sections, so it does not require the layout prepass of the whole tree.
+	 * The width is taken from the last layout of sections, so it is 0 until they are painted for the first time. */
 	UFUNCTION(BlueprintPure, Category = "Settings Widget Constructor|Style")
 	FVector2D GetSubWidgetsSize(
-		UPARAM(meta = (Bitmask, BitmaskEnum = "/Script/SettingsWidgetConstructor.EMyVerticalAlignment")) int32 SectionsBitmask) const;
+		UPARAM(meta = (Bitmask, BitmaskEnum = "/Script/SettingsWidgetConstructorCore.EMyVerticalAlignment")) int32 SectionsBitmask) const;
 
-	/** Returns the height of a setting scrollbox on the screen. */
+	/** Returns the height of a setting scrollbox on the screen.
+	 * Is cached and recalculated only when the viewport or settings rows are changed. */
 	UFUNCTION(BlueprintPure, Category = "Settings Widget Constructor|Style")
 	float GetScrollBoxHeight() const;
 
-	/** Is blueprint-event called that returns the style brush by specified button state. */
+	/** Is called by the sub-widget of specified setting after it was laid out with a new height.
+	 * Schedules the relayout on next tick if the row height was changed, so many measured rows per frame are coalesced into one. */
+	void OnSettingRowHeightMeasured(const FSettingTag& SettingTag, float MeasuredHeight);
+
+	/** Is blueprint-event called that returns the style brush by specified button state.
+	 * @see USettingsDataAsset::GetButtonBrush */
 	UFUNCTION(BlueprintPure, Category = "Settings Widget Constructor|Style")
-	FSlateBrush GetButtonBrush(ESettingsButtonState State) const;
+	const FSlateBrush& GetButtonBrush(ESettingsButtonState State) const;
 
 	/* ---------------------------------------------------
 	 *		Setters by setting types
@@ -132,6 +166,11 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Settings Widget Constructor|Setters", meta = (AutoCreateRefTerm = "Value"))
 	void SetSettingValue(FName TagName, const FString& Value);
 
+	/** Sets typed values to specified settings in one call without string parsing.
+	 * @see USettingsSubsystem::SetSettingValues */
+	UFUNCTION(BlueprintCallable, Category = "Settings Widget Constructor|Setters")
+	void SetSettingValues(const TArray<FSettingTag>& SettingTags, const TArray<FSettingValue>& Values);
+
 	/** Press button. */
 	UFUNCTION(BlueprintCallable, Category = "Settings Widget Constructor|Setters", meta = (AutoCreateRefTerm = "ButtonTag"))
 	void SetSettingButtonPressed(const FSettingTag& ButtonTag);
@@ -164,13 +203,13 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Settings Widget Constructor|Setters", meta = (AutoCreateRefTerm = "CustomWidgetTag"))
 	void SetSettingCustomWidget(const FSettingTag& CustomWidgetTag, class USettingCustomWidget* InCustomWidget);
 
-	/** Creates setting sub-widget (like button, checkbox etc.) based on specified setting class and sets it to specified primary data.
-	 * @param InOutPrimary The Data that should contain created setting class.
+	/** Creates setting sub-widget (like button, checkbox etc.) based on specified setting class and registers it by the tag of specified primary data.
+	 * @param InOutPrimary The Data of the setting which widget is created.
 	 * @param SettingSubWidgetClass The setting widget class to create. */
 	UFUNCTION(BlueprintCallable, Category = "Settings Widget Constructor", meta = (AutoCreateRefTerm = "InOutPrimary"))
 	USettingSubWidget* CreateSettingSubWidget(UPARAM(ref) FSettingsPrimary& InOutPrimary, const TSubclassOf<USettingSubWidget> SettingSubWidgetClass);
 
-	/** Creates setting sub-widget (like button, checkbox etc.) based on specified setting class and sets it to specified primary data. */
+	/** Creates setting sub-widget (like button, checkbox etc.) based on specified setting class and registers it by the tag of specified primary data. */
 	template <typename T = USettingSubWidget>
 	FORCEINLINE T* CreateSettingSubWidget(FSettingsPrimary& InOutPrimary, const TSubclassOf<USettingSubWidget> SettingSubWidgetClass) { return Cast<T>(CreateSettingSubWidget(InOutPrimary, SettingSubWidgetClass)); }
 
@@ -178,6 +217,11 @@ public:
 	 *		Getters by setting types
 	 * --------------------------------------------------- */
 
+	/** Returns typed values of specified settings in one call without string conversion.
+	 * @see USettingsSubsystem::GetSettingValues */
+	UFUNCTION(BlueprintPure, Category = "Settings Widget Constructor|Getters")
+	void GetSettingValues(const TArray<FSettingTag>& SettingTags, TArray<FSettingValue>& OutValues) const;
+
 	/** Returns is a checkbox toggled. */
 	UFUNCTION(BlueprintPure, Category = "Settings Widget Constructor|Getters", meta = (AutoCreateRefTerm = "CheckboxTag"))
 	bool GetCheckboxValue(const FSettingTag& CheckboxTag) const;
@@ -215,9 +259,9 @@ protected:
 	 *		Protected properties
 	 * --------------------------------------------------- */
 
-	/** Contains all settings. */
-	UPROPERTY(VisibleDefaultsOnly, BlueprintReadOnly, Transient, Category = "Settings Widget Constructor", meta = (BlueprintProtected, DisplayName = "Settings Table Rows"))
-	TMap<FName/*Tag*/, FSettingsPicker/*Row*/> SettingsTableRowsInternal;
+	/** Contains created sub-widgets of all shown settings. */
+	UPROPERTY(VisibleInstanceOnly, BlueprintReadOnly, Transient, Category = "Settings Widget Constructor", meta = (BlueprintProtected, DisplayName = "Setting Sub-Widgets"))
+	TMap<FName/*Tag*/, TObjectPtr<class USettingSubWidget>> SettingSubWidgetsInternal;
 
 	/** The index of the current column. */
 	UPROPERTY(VisibleDefaultsOnly, BlueprintReadWrite, Transient, Category = "Settings Widget Constructor", meta = (BlueprintProtected, DisplayName = "Current Column Index"))
@@ -231,6 +275,40 @@ protected:
 	UPROPERTY(VisibleDefaultsOnly, BlueprintReadOnly, Transient, Category = "Settings Widget Constructor", meta = (BlueprintProtected, DisplayName = "Setting ScrollBoxes"))
 	TArray<TObjectPtr<class USettingScrollBox>> SettingScrollBoxesInternal;
 
+	/** Heights of Header, Content (the highest column) and Footer sections, are calculated by heights and paddings of their rows.
+	 * @see USettingsWidget::UpdateSectionsHeight */
+	float HeaderHeightInternal = 0.f;
+	float ContentHeightInternal = 0.f;
+	float FooterHeightInternal = 0.f;
+
+	/** The viewport size and scale for which the scrollbox height was cached last time. */
+	mutable FVector2D CachedViewportSizeInternal = FVector2D::ZeroVector;
+	mutable float CachedViewportScaleInternal = 0.f;
+
+	/** The cached height of a setting scrollbox, is negative when has to be recalculated.
+	 * @see USettingsWidget::GetScrollBoxHeight */
+	mutable float CachedScrollBoxHeightInternal = INDEX_NONE;
+
+	/** The height that is currently set to all scrollboxes, is used to skip relayout when nothing is changed. */
+	float AppliedScrollBoxHeightInternal = INDEX_NONE;
+
+	/** Handles of bound viewport events.
+	 * @see USettingsWidget::OnViewportResizedWhenInit
+	 * @see USettingsWidget::OnViewportResized */
+	FDelegateHandle ViewportResizedWhenInitHandleInternal;
+	FDelegateHandle ViewportResizedHandleInternal;
+	FDelegateHandle WindowDPIScaleChangedHandleInternal;
+
+	/** Is true when the relayout is already scheduled on next tick, so many resize events per frame are coalesced into one. */
+	bool bIsRelayoutPendingInternal = false;
+
+	/** Real heights of rows that might be higher than their Line Height, are reported by their sub-widgets after they were laid out.
+	 * @see USettingsWidget::OnSettingRowHeightMeasured */
+	TMap<FName/*Tag*/, float> MeasuredRowHeightsInternal;
+
+	/** Is true when any measured row height was changed, so sections have to be recalculated on next relayout. */
+	bool bIsSectionsHeightDirtyInternal = false;
+
 	/* ---------------------------------------------------
 	 *		Bound widget properties
 	 * --------------------------------------------------- */
@@ -251,19 +329,34 @@ protected:
 	*		Protected functions
 	* --------------------------------------------------- */
 
+	/** Called once when the widget is created, starts listening changes of the Settings Subsystem. */
+	virtual void NativeOnInitialized() override;
+
 	/** Called after the underlying slate widget is constructed.
 	* May be called multiple times due to adding and removing from the hierarchy. */
 	virtual void NativeConstruct() override;
 
+	/** Called when the underlying slate widget is destructed, unbinds from viewport events. */
+	virtual void NativeDestruct() override;
+
 	/** Is called right after the game was started and windows size is set to construct settings. */
 	void OnViewportResizedWhenInit(class FViewport* Viewport, uint32 Index);
 
+	/** Is called on every viewport resize to schedule the relayout of constructed settings on next tick. */
+	void OnViewportResized(class FViewport* Viewport, uint32 Index);
+
+	/** Is called when DPI scale of any window was changed to schedule the relayout of constructed settings on next tick. */
+	void OnWindowDPIScaleChanged(TSharedRef<class SWindow> Window);
+
+	/** Recalculates only size-dependent values of already constructed settings, is called once per frame at most. */
+	void RelayoutSettings();
+
 	/** Is blueprint-event called on settings construct to cache some data before creating subwidgets. */
 	UFUNCTION(BlueprintCallable, BlueprintImplementableEvent, Category = "Settings Widget Constructor", meta = (BlueprintProtected))
 	void OnConstructSettings();
 	void ConstructSettings();
 
-	/** Internal function to cache setting rows from Settings Data Table. */
+	/** Internal function to cache setting rows from Settings Data Table in the Settings Subsystem and to recalculate sections by them. */
 	UFUNCTION(BlueprintCallable, Category = "Settings Widget Constructor", meta = (BlueprintProtected))
 	void UpdateSettingsTableRows();
 
@@ -271,15 +364,47 @@ protected:
 	UFUNCTION(BlueprintCallable, Category = "Settings Widget Constructor", meta = (BlueprintProtected))
 	void OnToggleSettings(bool bIsVisible);
 
-	/** Bind and set static object delegate.
-	* @see FSettingsPrimary::OnStaticContext */
-	UFUNCTION(BlueprintCallable, Category = "Settings Widget Constructor", meta = (BlueprintProtected))
-	void TryBindStaticContext(UPARAM(ref)FSettingsPrimary& Primary);
+	/** Is called when the value of any setting was changed in the Settings Subsystem to show it on UI. */
+	UFUNCTION()
+	void OnSettingChanged(const FSettingTag& SettingTag);
+
+	/** Is called when members of any combobox were changed in the Settings Subsystem to show them on UI. */
+	UFUNCTION()
+	void OnComboboxMembersChanged(const FSettingTag& SettingTag);
+
+	/** Is called when the async getter of any setting was started or finished in the Settings Subsystem, disables its sub-widget while loading. */
+	UFUNCTION()
+	void OnSettingLoadingChanged(const FSettingTag& SettingTag, bool bIsLoading);
+
+	/** Is called when the async getter of the setting was started or finished, e.g: to show a loading placeholder instead of combobox members.
+	 * @see USettingsSubsystem::IsSettingLoading */
+	UFUNCTION(BlueprintImplementableEvent, Category = "Settings Widget Constructor", meta = (BlueprintProtected))
+	void SetSettingLoading(const FSettingTag& SettingTag, bool bIsLoading);
+
+	/** Is called when the async setter of the setting was started or completed, e.g: to show a saving indicator next to the setting.
+	 * @see USettingsSubsystem::IsSettingInFlight */
+	UFUNCTION(BlueprintImplementableEvent, Category = "Settings Widget Constructor", meta = (BlueprintProtected))
+	void OnSettingInFlightChanged(const FSettingTag& SettingTag, bool bIsInFlight);
+
+	/** Is called when the setting that takes effect after restart was changed, e.g: to show the 'Restart Required' hint.
+	 * @see USettingsSubsystem::IsRestartRequired */
+	UFUNCTION(BlueprintImplementableEvent, Category = "Settings Widget Constructor", meta = (BlueprintProtected))
+	void OnRestartRequiredChanged(const FSettingTag& SettingTag, bool bIsRestartRequired);
 
 	/** Starts adding settings on the next column. */
 	UFUNCTION(BlueprintCallable, BlueprintNativeEvent, Category = "Settings Widget Constructor", meta = (BlueprintProtected))
 	void StartNextColumn();
 
+	/** Calculates amount of columns and heights of all sections by heights and paddings of their rows. */
+	void UpdateSectionsHeight();
+
+	/** Returns the height of specified setting row without its padding.
+	 * Line Height is only the minimal height of the row, so rows that might be higher are estimated without the layout prepass:
+	 * text lines by the theme font metrics and their lines number, custom widgets by their declared Desired Height.
+	 * Once such sub-widget is laid out, its real height is used instead.
+	 * @see USettingsWidget::OnSettingRowHeightMeasured */
+	float GetSettingRowHeight(const FSettingsPicker& Setting) const;
+
 	/** Automatically sets the height for all scrollboxes in the Settings. */
 	UFUNCTION(BlueprintCallable, Category = "Settings Widget Constructor", meta = (BlueprintProtected))
 	void UpdateScrollBoxesHeight();
@@ -15,6 +15,8 @@ public class SettingsWidgetConstructor : ModuleRules
 				, "UMG" // Created USettingsWidget
 				, "GameplayTags" // Created FSettingTag
 				, "DeveloperSettings" // Created USettingsDataAsset
+				// My modules
+				, "SettingsWidgetConstructorCore" // USettingsSubsystem
 			}
 		);
 
@@ -23,15 +25,5 @@ public class SettingsWidgetConstructor : ModuleRules
 				"CoreUObject", "Engine", "Slate", "SlateCore" // Core
 			}
 		);
-
-		if (Target.bBuildEditor)
-		{
-			// Include Editor modules that are used in this Runtime module
-			PrivateDependencyModuleNames.AddRange(new[]
-				{
-					"UnrealEd" // FDataTableEditorUtils
-				}
-			);
-		}
 	}
 }
@@ -0,0 +1,146 @@
+﻿// Copyright (c) Yevhenii Selivanov
+
+#include "Data/SettingValue.h"
+//---
+#include UE_INLINE_GENERATED_CPP_BY_NAME(SettingValue)
+
+// Value that contains nothing
+const FSettingValue FSettingValue::Empty = FSettingValue();
+
+// Creates the value of Bool type
+FSettingValue FSettingValue::MakeBool(bool InValue)
+{
+	FSettingValue Value;
+	Value.Type = ESettingValueType::Bool;
+	Value.BoolValue = InValue;
+	return Value;
+}
+
+// Creates the value of Int type
+FSettingValue FSettingValue::MakeInt(int32 InValue)
+{
+	FSettingValue Value;
+	Value.Type = ESettingValueType::Int;
+	Value.IntValue = InValue;
+	return Value;
+}
+
+// Creates the value of Float type
+FSettingValue FSettingValue::MakeFloat(double InValue)
+{
+	FSettingValue Value;
+	Value.Type = ESettingValueType::Float;
+	Value.FloatValue = InValue;
+	return Value;
+}
+
+// Creates the value of Name type
+FSettingValue FSettingValue::MakeName(FName InValue)
+{
+	FSettingValue Value;
+	Value.Type = ESettingValueType::Name;
+	Value.NameValue = InValue;
+	return Value;
+}
+
+// Creates the value of Text type
+FSettingValue FSettingValue::MakeText(const FText& InValue)
+{
+	FSettingValue Value;
+	Value.Type = ESettingValueType::Text;
+	Value.TextValue = InValue;
+	return Value;
+}
+
+// Creates the value of Members type
+FSettingValue FSettingValue::MakeMembers(const TArray<FText>& InValue, int32 InChosenIndex)
+{
+	FSettingValue Value;
+	Value.Type = ESettingValueType::Members;
+	Value.MembersValue = InValue;
+	Value.IntValue = InChosenIndex;
+	return Value;
+}
+
+// Compares the types and values of their types
+bool FSettingValue::operator==(const FSettingValue& Other) const
+{
+	if (Type != Other.Type)
+	{
+		return false;
+	}
+
+	switch (Type)
+	{
+	case ESettingValueType::Bool:
+		return BoolValue == Other.BoolValue;
+	case ESettingValueType::Int:
+		return IntValue == Other.IntValue;
+	case ESettingValueType::Float:
+		return FMath::IsNearlyEqual(FloatValue, Other.FloatValue);
+	case ESettingValueType::Name:
+		return NameValue == Other.NameValue;
+	case ESettingValueType::Text:
+		return TextValue.EqualTo(Other.TextValue);
+	case ESettingValueType::Members:
+		{
+			if (IntValue != Other.IntValue
+				|| MembersValue.Num() != Other.MembersValue.Num())
+			{
+				return false;
+			}
+
+			for (int32 Index = 0; Index < MembersValue.Num(); ++Index)
+			{
+				if (!MembersValue[Index].EqualTo(Other.MembersValue[Index]))
+				{
+					return false;
+				}
+			}
+			return true;
+		}
+	default:
+		return true;
+	}
+}
+
+// Serializes the type and only the value of this type
+FArchive& operator<<(FArchive& Ar, FSettingValue& Value)
+{
+	Ar << Value.Type;
+
+	switch (Value.Type)
+	{
+	case ESettingValueType::Bool:
+		Ar << Value.BoolValue;
+		break;
+	case ESettingValueType::Int:
+		Ar << Value.IntValue;
+		break;
+	case ESettingValueType::Float:
+		Ar << Value.FloatValue;
+		break;
+	case ESettingValueType::Name:
+		{
+			// Is stored as string, since the binary archive doesn't support names
+			FString NameString = Value.NameValue.ToString();
+			Ar << NameString;
+			if (Ar.IsLoading())
+			{
+				Value.NameValue = *NameString;
+			}
+			break;
+		}
+	case ESettingValueType::Text:
+		Ar << Value.TextValue;
+		break;
+	case ESettingValueType::Members:
+		Ar << Value.MembersValue;
+		Ar << Value.IntValue;
+		break;
+	default:
+		break;
+	}
+
+	return Ar;
+}
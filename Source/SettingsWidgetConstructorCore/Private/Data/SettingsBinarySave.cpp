@@ -0,0 +1,127 @@
+﻿// Copyright (c) Yevhenii Selivanov
+
+#include "Data/SettingsBinarySave.h"
+//---
+#include "SettingsWidgetConstructorCoreModule.h"
+//---
+#include "HAL/FileManager.h"
+#include "Misc/Paths.h"
+
+// Is called for each loaded record of older version
+FSettingsBinarySave::FOnMigrateSettingValue FSettingsBinarySave::OnMigrateSettingValue;
+
+// Returns the path of the save file in the Saved folder of the project
+FString FSettingsBinarySave::GetFilename()
+{
+	return FPaths::ProjectSavedDir() / TEXT("SaveGames") / TEXT("SettingsWidgetConstructor.sav");
+}
+
+// Reads all saved values from specified file
+bool FSettingsBinarySave::LoadFromFile(const FString& Filename, TMap<FName, FSettingValue>& OutValues)
+{
+	OutValues.Reset();
+
+	const TUniquePtr<FArchive> FileReader(IFileManager::Get().CreateFileReader(*Filename, FILEREAD_Silent));
+	if (!FileReader)
+	{
+		return false;
+	}
+
+	if (!Serialize(*FileReader, OutValues)
+		|| !FileReader->Close())
+	{
+		UE_LOG(LogSettingsWidgetConstructor, Warning, TEXT("%s: the settings save is corrupted and is ignored"), *Filename);
+		OutValues.Reset();
+		return false;
+	}
+
+	return true;
+}
+
+// Writes specified values into the temporary file and replaces specified file by it
+bool FSettingsBinarySave::SaveToFile(const FString& Filename, const TMap<FName, FSettingValue>& Values)
+{
+	const FString TempFilename = Filename + TEXT(".tmp");
+	{
+		const TUniquePtr<FArchive> FileWriter(IFileManager::Get().CreateFileWriter(*TempFilename));
+		if (!FileWriter)
+		{
+			return false;
+		}
+
+		const bool bIsSerialized = Serialize(*FileWriter, const_cast<TMap<FName, FSettingValue>&>(Values));
+		if (!FileWriter->Close()
+			|| !bIsSerialized)
+		{
+			// Never replace the previous save by the half-written one
+			UE_LOG(LogSettingsWidgetConstructor, Warning, TEXT("%s: failed to write the settings save"), *TempFilename);
+			IFileManager::Get().Delete(*TempFilename, /*RequireExists*/false, /*EvenReadOnly*/true, /*Quiet*/true);
+			return false;
+		}
+	}
+
+	return IFileManager::Get().Move(*Filename, *TempFilename, /*bReplace*/true);
+}
+
+// Reads or writes all values by specified archive
+bool FSettingsBinarySave::Serialize(FArchive& Ar, TMap<FName, FSettingValue>& InOutValues)
+{
+	uint32 FileMagic = Magic;
+	Ar << FileMagic;
+	if (Ar.IsError() || FileMagic != Magic)
+	{
+		return false;
+	}
+
+	int32 Version = Latest;
+	Ar << Version;
+	if (Ar.IsError() || Version <= 0 || Version > Latest)
+	{
+		return false;
+	}
+
+	int32 RecordsNum = InOutValues.Num();
+	Ar << RecordsNum;
+	if (Ar.IsError() || RecordsNum < 0)
+	{
+		return false;
+	}
+
+	if (Ar.IsSaving())
+	{
+		// Each record keeps the tag name as a string, since names are not stable between sessions
+		for (TTuple<FName, FSettingValue>& ValueIt : InOutValues)
+		{
+			FString TagName = ValueIt.Key.ToString();
+			Ar << TagName;
+			Ar << ValueIt.Value;
+		}
+		return !Ar.IsError();
+	}
+
+	InOutValues.Reset();
+	InOutValues.Reserve(RecordsNum);
+	for (int32 RecordIndex = 0; RecordIndex < RecordsNum; ++RecordIndex)
+	{
+		FString TagName;
+		FSettingValue Value;
+		Ar << TagName;
+		Ar << Value;
+		if (Ar.IsError() || TagName.IsEmpty())
+		{
+			return false;
+		}
+
+		FName Tag = *TagName;
+		if (Version < Latest
+			&& OnMigrateSettingValue.IsBound()
+			&& !OnMigrateSettingValue.Execute(Version, /*InOut*/Tag, /*InOut*/Value))
+		{
+			continue;
+		}
+
+		InOutValues.Emplace(Tag, MoveTemp(Value));
+	}
+
+	return true;
+}
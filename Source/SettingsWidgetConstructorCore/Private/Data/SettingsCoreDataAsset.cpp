@@ -0,0 +1,34 @@
+﻿// Copyright (c) Yevhenii Selivanov
+
+#include "Data/SettingsCoreDataAsset.h"
+//---
+#include "Data/SettingsDataTable.h"
+//---
+#include UE_INLINE_GENERATED_CPP_BY_NAME(SettingsCoreDataAsset)
+
+// Returns the data table
+USettingsDataTable* USettingsCoreDataAsset::GetSettingsDataTable() const
+{
+	return SettingsDataTableInternal.LoadSynchronous();
+}
+
+// Is overridden to read the data table from the config section of the UI settings, where it was stored before
+void USettingsCoreDataAsset::PostInitProperties()
+{
+	Super::PostInitProperties();
+
+	if (!HasAnyFlags(RF_ClassDefaultObject)
+		|| !SettingsDataTableInternal.IsNull()
+		|| !GConfig)
+	{
+		return;
+	}
+
+	static const FString OldSection = TEXT("/Script/SettingsWidgetConstructor.SettingsDataAsset");
+	FString OldSettingsDataTable;
+	if (GConfig->GetString(*OldSection, TEXT("SettingsDataTableInternal"), /*out*/OldSettingsDataTable, GetClass()->GetConfigName())
+		&& !OldSettingsDataTable.IsEmpty())
+	{
+		SettingsDataTableInternal = TSoftObjectPtr<USettingsDataTable>(FSoftObjectPath(OldSettingsDataTable));
+	}
+}
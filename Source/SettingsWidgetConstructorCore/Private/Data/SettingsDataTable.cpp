@@ -0,0 +1,80 @@
+﻿// Copyright (c) Yevhenii Selivanov.
+
+#include "Data/SettingsDataTable.h"
+//---
+#include "Data/SettingsDataTableValidator.h"
+//---
+#if WITH_EDITOR
+#include "DataTableEditorUtils.h" // FDataTableEditorUtils::RenameRow
+#include "UObject/ObjectSaveContext.h"
+#endif
+//---
+#include UE_INLINE_GENERATED_CPP_BY_NAME(SettingsDataTable)
+
+// Default constructor to set members as FSettingsRow
+USettingsDataTable::USettingsDataTable()
+{
+	RowStruct = FSettingsRow::StaticStruct();
+}
+
+#if WITH_EDITOR
+// Exchanges all rows with specified table without copying them
+void USettingsDataTable::SwapRows(USettingsDataTable& OtherTable)
+{
+	if (!ensureMsgf(RowStruct == OtherTable.RowStruct, TEXT("ASSERT: 'OtherTable' has another row struct")))
+	{
+		return;
+	}
+
+	Swap(RowMap, OtherTable.RowMap);
+}
+
+// Called on every change in this data table to automatic set the key name by specified setting tag
+void USettingsDataTable::OnThisDataTableChanged(FName RowKey, const uint8& RowData)
+{
+	// Set row name by specified tag
+	const FSettingsRow& Row = reinterpret_cast<const FSettingsRow&>(RowData);
+	const FName RowValueTag = Row.SettingsPicker.PrimaryData.Tag.GetTagName();
+	if (!RowValueTag.IsNone() // Tag is not empty
+		&& RowKey != RowValueTag // New tag name
+		&& !RowMap.Contains(RowValueTag)) // Unique key
+	{
+		FDataTableEditorUtils::RenameRow(this, RowKey, RowValueTag);
+	}
+
+	// Export to .json
+	Super::OnThisDataTableChanged(RowKey, RowData);
+}
+
+// Is called on saving to validate this table during cook, dead bindings fail the cook, while other issues are warnings
+void USettingsDataTable::PreSave(FObjectPreSaveContext ObjectSaveContext)
+{
+	Super::PreSave(ObjectSaveContext);
+
+	if (!ObjectSaveContext.IsCooking())
+	{
+		return;
+	}
+
+	const FSettingsValidationReport Report = FSettingsDataTableValidator::Validate(*this);
+	Report.LogIssues();
+}
+
+// Validates cycles, dead bindings and fan-outs of this table by the Data Validation
+EDataValidationResult USettingsDataTable::IsDataValid(TArray<FText>& ValidationErrors)
+{
+	EDataValidationResult Result = Super::IsDataValid(ValidationErrors);
+
+	const FSettingsValidationReport Report = FSettingsDataTableValidator::Validate(*this);
+	for (const FSettingsValidationIssue& IssueIt : Report.Issues)
+	{
+		if (IssueIt.Severity == ESettingsValidationSeverity::Error)
+		{
+			ValidationErrors.Emplace(FText::FromString(FString::Printf(TEXT("[%s]: %s"), *IssueIt.RowName.ToString(), *IssueIt.Message)));
+			Result = EDataValidationResult::Invalid;
+		}
+	}
+
+	return Result == EDataValidationResult::NotValidated ? EDataValidationResult::Valid : Result;
+}
+#endif // WITH_EDITOR
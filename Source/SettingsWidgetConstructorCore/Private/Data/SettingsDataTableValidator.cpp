@@ -0,0 +1,494 @@
+﻿// Copyright (c) Yevhenii Selivanov
+
+#include "Data/SettingsDataTableValidator.h"
+//---
+#include "SettingsWidgetConstructorCoreModule.h"
+#include "Data/SettingsDataTable.h"
+
+namespace SettingsDataTableValidator
+{
+	/** The meta keys of function templates.
+	 * @see FSWCFunctionPicker */
+	static const FName FunctionSetterTemplate = TEXT("FunctionSetterTemplate");
+	static const FName FunctionGetterTemplate = TEXT("FunctionGetterTemplate");
+
+	/** Returns true if specified function is not chosen or is native, so it can be called outside of the game thread.
+	 * Functions that are not found are reported separately, so they are not treated as blueprint ones. */
+	static bool IsNativeFunction(const FSettingFunctionPicker& FunctionPicker, const UClass* ContextClass)
+	{
+		if (FunctionPicker.FunctionName.IsNone())
+		{
+			return true;
+		}
+
+		const UClass* FunctionClass = FunctionPicker.FunctionClass && FunctionPicker.FunctionClass->IsChildOf(ContextClass) ? FunctionPicker.FunctionClass.Get() : ContextClass;
+		const UFunction* Function = FunctionClass->FindFunctionByName(FunctionPicker.FunctionName);
+		return !Function || Function->HasAnyFunctionFlags(FUNC_Native);
+	}
+
+	/** Finds strongly connected components of the graph by Tarjan's algorithm.
+	 * Components are added in reverse topological order: the settings that update nothing come first. */
+	struct FStronglyConnectedComponents
+	{
+		const TArray<TArray<int32>>& Edges;
+		TArray<TArray<int32>> Components;
+
+		TArray<int32> Indices;
+		TArray<int32> LowLinks;
+		TArray<bool> OnStack;
+		TArray<int32> Stack;
+		int32 NextIndex = 0;
+
+		explicit FStronglyConnectedComponents(const TArray<TArray<int32>>& InEdges)
+			: Edges(InEdges)
+		{
+			const int32 NodesNum = Edges.Num();
+			Indices.Init(INDEX_NONE, NodesNum);
+			LowLinks.Init(INDEX_NONE, NodesNum);
+			OnStack.Init(false, NodesNum);
+
+			for (int32 Node = 0; Node < NodesNum; ++Node)
+			{
+				if (Indices[Node] == INDEX_NONE)
+				{
+					Visit(Node);
+				}
+			}
+		}
+
+		void Visit(int32 Node)
+		{
+			Indices[Node] = LowLinks[Node] = NextIndex++;
+			Stack.Push(Node);
+			OnStack[Node] = true;
+
+			for (const int32 NextNode : Edges[Node])
+			{
+				if (Indices[NextNode] == INDEX_NONE)
+				{
+					Visit(NextNode);
+					LowLinks[Node] = FMath::Min(LowLinks[Node], LowLinks[NextNode]);
+				}
+				else if (OnStack[NextNode])
+				{
+					LowLinks[Node] = FMath::Min(LowLinks[Node], Indices[NextNode]);
+				}
+			}
+
+			if (LowLinks[Node] != Indices[Node])
+			{
+				return;
+			}
+
+			TArray<int32>& Component = Components.AddDefaulted_GetRef();
+			int32 PoppedNode = INDEX_NONE;
+			do
+			{
+				PoppedNode = Stack.Pop(/*bAllowShrinking*/false);
+				OnStack[PoppedNode] = false;
+				Component.Emplace(PoppedNode);
+			}
+			while (PoppedNode != Node);
+		}
+	};
+}
+
+// Returns 'Error' or 'Warning'
+const TCHAR* FSettingsValidationIssue::GetSeverityName() const
+{
+	return Severity == ESettingsValidationSeverity::Error ? TEXT("Error") : TEXT("Warning");
+}
+
+// Returns amount of issues of specified severity
+int32 FSettingsValidationReport::GetIssuesNum(ESettingsValidationSeverity Severity) const
+{
+	int32 IssuesNum = 0;
+	for (const FSettingsValidationIssue& IssueIt : Issues)
+	{
+		IssuesNum += static_cast<int32>(IssueIt.Severity == Severity);
+	}
+	return IssuesNum;
+}
+
+// Adds new problem to the report
+void FSettingsValidationReport::AddIssue(ESettingsValidationSeverity Severity, FName RowName, const FString& Message)
+{
+	FSettingsValidationIssue& IssueRef = Issues.AddDefaulted_GetRef();
+	IssueRef.Severity = Severity;
+	IssueRef.RowName = RowName;
+	IssueRef.Message = Message;
+}
+
+// Prints all found problems into the log
+void FSettingsValidationReport::LogIssues() const
+{
+	for (const FSettingsValidationIssue& IssueIt : Issues)
+	{
+		if (IssueIt.Severity == ESettingsValidationSeverity::Error)
+		{
+			UE_LOG(LogSettingsWidgetConstructor, Error, TEXT("%s [%s]: %s"), *TablePathName, *IssueIt.RowName.ToString(), *IssueIt.Message);
+		}
+		else
+		{
+			UE_LOG(LogSettingsWidgetConstructor, Warning, TEXT("%s [%s]: %s"), *TablePathName, *IssueIt.RowName.ToString(), *IssueIt.Message);
+		}
+	}
+}
+
+// Validates all rows of specified settings table
+FSettingsValidationReport FSettingsDataTableValidator::Validate(const USettingsDataTable& SettingsDataTable, int32 MaxPropagationSize)
+{
+	FSettingsValidationReport Report;
+	Report.TablePathName = SettingsDataTable.GetPathName();
+
+	TMap<FName, FSettingsRow> SettingRows;
+	SettingsDataTable.GetSettingRows(/*Out*/SettingRows);
+	Report.RowsNum = SettingRows.Num();
+
+	TMap<FName, FName> RowsByTag;
+	RowsByTag.Reserve(SettingRows.Num());
+	for (const TTuple<FName, FSettingsRow>& RowIt : SettingRows)
+	{
+		const FName RowName = RowIt.Key;
+		const FSettingsPicker& SettingsPicker = RowIt.Value.SettingsPicker;
+
+		const FName TagName = SettingsPicker.PrimaryData.Tag.GetTagName();
+		if (TagName.IsNone())
+		{
+			Report.AddIssue(ESettingsValidationSeverity::Warning, RowName, TEXT("Setting tag is not set, so this setting can't be found or updated"));
+		}
+		else if (const FName* DuplicatedRow = RowsByTag.Find(TagName))
+		{
+			Report.AddIssue(ESettingsValidationSeverity::Warning, RowName, FString::Printf(TEXT("Setting tag '%s' is already used by '%s' row"), *TagName.ToString(), *DuplicatedRow->ToString()));
+		}
+		else
+		{
+			RowsByTag.Emplace(TagName, RowName);
+		}
+
+		ValidateBindings(RowName, SettingsPicker, Report);
+	}
+
+	ValidateGraph(SettingRows, MaxPropagationSize, Report);
+
+	return Report;
+}
+
+// Resolves all bound functions of specified row and reports the ones that can't be bound at runtime
+void FSettingsDataTableValidator::ValidateBindings(FName RowName, const FSettingsPicker& SettingsPicker, FSettingsValidationReport& InOutReport)
+{
+	using namespace SettingsDataTableValidator;
+
+	const FSettingsDataBase* ChosenData = SettingsPicker.GetChosenSettingsData();
+	if (!ChosenData)
+	{
+		InOutReport.AddIssue(ESettingsValidationSeverity::Warning, RowName, TEXT("Settings type is not chosen, so this setting is never added"));
+		return;
+	}
+
+	const FSettingsPrimary& Primary = SettingsPicker.PrimaryData;
+	const bool bHasBoundFunctions = !Primary.Setter.FunctionName.IsNone()
+		|| !Primary.Getter.FunctionName.IsNone()
+		|| (ChosenData == &SettingsPicker.Combobox && (!SettingsPicker.Combobox.GetMembers.FunctionName.IsNone() || !SettingsPicker.Combobox.SetMembers.FunctionName.IsNone()));
+
+	// Resolve the class of Static Context object by the return value of its function
+	const FSettingFunctionPicker& StaticContext = Primary.StaticContext;
+	if (!StaticContext.FunctionClass || StaticContext.FunctionName.IsNone())
+	{
+		if (bHasBoundFunctions)
+		{
+			InOutReport.AddIssue(ESettingsValidationSeverity::Error, RowName, TEXT("Setter or Getter is chosen, but Static Context is not set, so nothing is bound"));
+		}
+		return;
+	}
+
+	const UFunction* StaticContextFunction = StaticContext.GetFunction();
+	if (!StaticContextFunction)
+	{
+		InOutReport.AddIssue(ESettingsValidationSeverity::Error, RowName, FString::Printf(TEXT("Static Context function '%s' is not found in '%s' class"), *StaticContext.FunctionName.ToString(), *StaticContext.FunctionClass->GetName()));
+		return;
+	}
+
+	const FObjectPropertyBase* ReturnProperty = CastField<FObjectPropertyBase>(StaticContextFunction->GetReturnProperty());
+	const UClass* ContextClass = ReturnProperty ? ReturnProperty->PropertyClass : nullptr;
+	if (!ContextClass)
+	{
+		InOutReport.AddIssue(ESettingsValidationSeverity::Error, RowName, FString::Printf(TEXT("Static Context function '%s' does not return any object"), *StaticContext.FunctionName.ToString()));
+		return;
+	}
+
+	const UScriptStruct* ChosenStruct = nullptr;
+	if (const FStructProperty* ChosenProperty = CastField<FStructProperty>(FSettingsPicker::StaticStruct()->FindPropertyByName(SettingsPicker.SettingsType)))
+	{
+		ChosenStruct = ChosenProperty->Struct;
+	}
+
+	ValidateFunction(RowName, TEXT("Setter"), Primary.Setter, ContextClass, FindTemplateMetaValue(ChosenStruct, FunctionSetterTemplate), InOutReport);
+	ValidateFunction(RowName, TEXT("Getter"), Primary.Getter, ContextClass, FindTemplateMetaValue(ChosenStruct, FunctionGetterTemplate), InOutReport);
+
+	if (ChosenData == &SettingsPicker.Combobox)
+	{
+		FString GetMembersTemplate;
+		FString SetMembersTemplate;
+#if WITH_EDITORONLY_DATA
+		const UStruct* ComboboxStruct = FSettingsCombobox::StaticStruct();
+		const FProperty* GetMembersProperty = ComboboxStruct->FindPropertyByName(GET_MEMBER_NAME_CHECKED(FSettingsCombobox, GetMembers));
+		const FProperty* SetMembersProperty = ComboboxStruct->FindPropertyByName(GET_MEMBER_NAME_CHECKED(FSettingsCombobox, SetMembers));
+		GetMembersTemplate = GetMembersProperty ? GetMembersProperty->GetMetaData(FunctionGetterTemplate) : TEXT("");
+		SetMembersTemplate = SetMembersProperty ? SetMembersProperty->GetMetaData(FunctionSetterTemplate) : TEXT("");
+#endif // WITH_EDITORONLY_DATA
+		ValidateFunction(RowName, TEXT("GetMembers"), SettingsPicker.Combobox.GetMembers, ContextClass, GetMembersTemplate, InOutReport);
+		ValidateFunction(RowName, TEXT("SetMembers"), SettingsPicker.Combobox.SetMembers, ContextClass, SetMembersTemplate, InOutReport);
+	}
+
+	if (!Primary.bIsThreadSafe
+		&& !Primary.bIsThreadSafeGetter)
+	{
+		return;
+	}
+
+	// Blueprint functions can be called only on the game thread, so thread-safe flags are ignored at runtime for them
+	const auto ValidateThreadSafe = [RowName, ContextClass, &InOutReport](const TCHAR* FunctionKind, const FSettingFunctionPicker& FunctionPicker)
+	{
+		if (!IsNativeFunction(FunctionPicker, ContextClass))
+		{
+			InOutReport.AddIssue(ESettingsValidationSeverity::Warning, RowName, FString::Printf(TEXT("Setting is marked as thread-safe, but %s '%s' is a blueprint function, so the flag is ignored"),
+			                                                                                   FunctionKind, *FunctionPicker.FunctionName.ToString()));
+		}
+	};
+
+	ValidateThreadSafe(TEXT("Getter"), Primary.Getter);
+	if (ChosenData == &SettingsPicker.Combobox)
+	{
+		ValidateThreadSafe(TEXT("GetMembers"), SettingsPicker.Combobox.GetMembers);
+	}
+	if (Primary.bIsThreadSafe)
+	{
+		ValidateThreadSafe(TEXT("Setter"), Primary.Setter);
+	}
+}
+
+// Reports specified Setter or Getter if it can't be found in the class of Static Context object
+void FSettingsDataTableValidator::ValidateFunction(FName RowName, const TCHAR* FunctionKind, const FSettingFunctionPicker& FunctionPicker, const UClass* ContextClass, const FString& TemplateMetaValue, FSettingsValidationReport& InOutReport)
+{
+	const FName FunctionName = FunctionPicker.FunctionName;
+	if (FunctionName.IsNone()
+		|| !ContextClass)
+	{
+		return;
+	}
+
+	// The function might be declared in the child class of returned object, so search there if it's chosen
+	const UClass* FunctionClass = ContextClass;
+	if (FunctionPicker.FunctionClass)
+	{
+		if (!FunctionPicker.FunctionClass->IsChildOf(ContextClass)
+			&& !ContextClass->IsChildOf(FunctionPicker.FunctionClass))
+		{
+			InOutReport.AddIssue(ESettingsValidationSeverity::Error, RowName, FString::Printf(TEXT("%s '%s' is chosen from '%s' class, but Static Context returns unrelated '%s' class"),
+			                                                                                 FunctionKind, *FunctionName.ToString(), *FunctionPicker.FunctionClass->GetName(), *ContextClass->GetName()));
+			return;
+		}
+
+		if (FunctionPicker.FunctionClass->IsChildOf(ContextClass))
+		{
+			FunctionClass = FunctionPicker.FunctionClass;
+		}
+	}
+
+	const UFunction* Function = FunctionClass->FindFunctionByName(FunctionName);
+	if (!Function)
+	{
+		InOutReport.AddIssue(ESettingsValidationSeverity::Error, RowName, FString::Printf(TEXT("%s '%s' is not found in '%s' class, so it's never bound"),
+		                                                                                 FunctionKind, *FunctionName.ToString(), *FunctionClass->GetName()));
+		return;
+	}
+
+	const UFunction* TemplateFunction = FindTemplateFunction(TemplateMetaValue);
+	if (TemplateFunction
+		&& !Function->IsSignatureCompatibleWith(TemplateFunction))
+	{
+		InOutReport.AddIssue(ESettingsValidationSeverity::Warning, RowName, FString::Printf(TEXT("%s '%s' signature does not match '%s' template"),
+		                                                                                   FunctionKind, *FunctionName.ToString(), *TemplateFunction->GetName()));
+	}
+}
+
+// Builds the dependency graph of SettingsToUpdate, reports its cycles and the worst-case propagation size of each row
+void FSettingsDataTableValidator::ValidateGraph(const TMap<FName, FSettingsRow>& SettingRows, int32 MaxPropagationSize, FSettingsValidationReport& InOutReport)
+{
+	TArray<FName> RowNames;
+	TArray<const FSettingsPicker*> Settings;
+	RowNames.Reserve(SettingRows.Num());
+	Settings.Reserve(SettingRows.Num());
+	for (const TTuple<FName, FSettingsRow>& RowIt : SettingRows)
+	{
+		RowNames.Emplace(RowIt.Key);
+		Settings.Emplace(&RowIt.Value.SettingsPicker);
+	}
+
+	// Only these settings call their setters on update and thereby update their own SettingsToUpdate
+	const int32 NodesNum = Settings.Num();
+	TArray<bool> IsUpdatable;
+	IsUpdatable.Init(false, NodesNum);
+	for (int32 Node = 0; Node < NodesNum; ++Node)
+	{
+		const FSettingsPicker& Setting = *Settings[Node];
+		const FSettingsDataBase* ChosenData = Setting.GetChosenSettingsData();
+		IsUpdatable[Node] = Setting.PrimaryData.Tag.IsValid()
+			&& (ChosenData == &Setting.Checkbox
+				|| ChosenData == &Setting.Combobox
+				|| ChosenData == &Setting.Slider
+				|| ChosenData == &Setting.TextLine
+				|| ChosenData == &Setting.UserInput);
+	}
+
+	// Edge from the setting to each setting it updates
+	TArray<TArray<int32>> Edges;
+	Edges.SetNum(NodesNum);
+	for (int32 Node = 0; Node < NodesNum; ++Node)
+	{
+		const FGameplayTagContainer& SettingsToUpdate = Settings[Node]->PrimaryData.SettingsToUpdate;
+		if (SettingsToUpdate.IsEmpty())
+		{
+			continue;
+		}
+
+		for (int32 NextNode = 0; NextNode < NodesNum; ++NextNode)
+		{
+			// Self-matches come from parent tags in SettingsToUpdate and are not propagated, since the setter skips the same value
+			if (NextNode != Node
+				&& IsUpdatable[NextNode]
+				&& Settings[NextNode]->PrimaryData.Tag.MatchesAny(SettingsToUpdate))
+			{
+				Edges[Node].Emplace(NextNode);
+			}
+		}
+	}
+
+	// Report cycles, they converge once values stop changing, but each change might call their setters many times
+	const SettingsDataTableValidator::FStronglyConnectedComponents SCC(Edges);
+	TArray<bool> IsCyclic;
+	IsCyclic.Init(false, NodesNum);
+	for (const TArray<int32>& ComponentIt : SCC.Components)
+	{
+		const int32 FirstNode = ComponentIt[0];
+		if (ComponentIt.Num() == 1)
+		{
+			continue;
+		}
+
+		TArray<FName>& CycleRef = InOutReport.Cycles.AddDefaulted_GetRef();
+		FString CycleString;
+		for (const int32 NodeIt : ComponentIt)
+		{
+			IsCyclic[NodeIt] = true;
+			CycleRef.Emplace(RowNames[NodeIt]);
+			CycleString += (CycleString.IsEmpty() ? TEXT("") : TEXT(" <-> ")) + RowNames[NodeIt].ToString();
+		}
+
+		InOutReport.AddIssue(ESettingsValidationSeverity::Warning, RowNames[FirstNode], FString::Printf(TEXT("SettingsToUpdate cycle repeats updates until values stop changing: %s"), *CycleString));
+	}
+
+	// Count setter calls of each cascade, components come in reverse topological order, so all next settings are already counted
+	static constexpr int64 MaxCallsNum = MAX_int32;
+	TArray<int64> CascadeCalls;
+	TArray<bool> IsUnbounded;
+	CascadeCalls.Init(0, NodesNum);
+	IsUnbounded.Init(false, NodesNum);
+	for (const TArray<int32>& ComponentIt : SCC.Components)
+	{
+		for (const int32 Node : ComponentIt)
+		{
+			if (IsCyclic[Node])
+			{
+				IsUnbounded[Node] = true;
+				continue;
+			}
+
+			for (const int32 NextNode : Edges[Node])
+			{
+				IsUnbounded[Node] |= IsUnbounded[NextNode];
+				CascadeCalls[Node] = FMath::Min(CascadeCalls[Node] + 1 + CascadeCalls[NextNode], MaxCallsNum);
+			}
+		}
+	}
+
+	TBitArray<> Visited;
+	TArray<int32> NodesToVisit;
+	for (int32 Node = 0; Node < NodesNum; ++Node)
+	{
+		if (Edges[Node].IsEmpty())
+		{
+			continue;
+		}
+
+		// Count unique updated settings
+		Visited.Init(false, NodesNum);
+		NodesToVisit.Reset();
+		NodesToVisit.Append(Edges[Node]);
+		int32 ReachableNum = 0;
+		while (!NodesToVisit.IsEmpty())
+		{
+			const int32 NodeIt = NodesToVisit.Pop(/*bAllowShrinking*/false);
+			if (Visited[NodeIt])
+			{
+				continue;
+			}
+
+			Visited[NodeIt] = true;
+			++ReachableNum;
+			NodesToVisit.Append(Edges[NodeIt]);
+		}
+
+		FSettingsPropagationCost& CostRef = InOutReport.PropagationCosts.AddDefaulted_GetRef();
+		CostRef.RowName = RowNames[Node];
+		CostRef.ReachableNum = ReachableNum;
+		CostRef.CascadeCallsNum = CascadeCalls[Node];
+		CostRef.bIsUnbounded = IsUnbounded[Node];
+
+		if (!CostRef.bIsUnbounded
+			&& CostRef.CascadeCallsNum > MaxPropagationSize)
+		{
+			InOutReport.AddIssue(ESettingsValidationSeverity::Warning, CostRef.RowName, FString::Printf(TEXT("Change of this setting causes %lld setter calls of %d settings, the limit is %d"),
+			                                                                                           CostRef.CascadeCallsNum, CostRef.ReachableNum, MaxPropagationSize));
+		}
+	}
+
+	InOutReport.PropagationCosts.Sort([](const FSettingsPropagationCost& A, const FSettingsPropagationCost& B)
+	{
+		if (A.bIsUnbounded != B.bIsUnbounded)
+		{
+			return A.bIsUnbounded;
+		}
+		return A.CascadeCallsNum > B.CascadeCallsNum;
+	});
+}
+
+// Returns the template function by its meta value like '/Script/ModuleName.ClassName::FunctionName'
+const UFunction* FSettingsDataTableValidator::FindTemplateFunction(const FString& TemplateMetaValue)
+{
+	FString ClassPathName;
+	FString FunctionName;
+	if (!TemplateMetaValue.Split(TEXT("::"), &ClassPathName, &FunctionName))
+	{
+		return nullptr;
+	}
+
+	const UClass* ScopeClass = UClass::TryFindTypeSlow<UClass>(ClassPathName, EFindFirstObjectOptions::ExactClass);
+	return ScopeClass ? ScopeClass->FindFunctionByName(*FunctionName) : nullptr;
+}
+
+// Returns the meta value of specified key from the struct or any of its parents, is empty if not found
+FString FSettingsDataTableValidator::FindTemplateMetaValue(const UStruct* Struct, FName MetaKey)
+{
+#if WITH_EDITORONLY_DATA
+	for (const UStruct* StructIt = Struct; StructIt; StructIt = StructIt->GetSuperStruct())
+	{
+		if (const FString* FoundMetaData = StructIt->FindMetaData(MetaKey))
+		{
+			return *FoundMetaData;
+		}
+	}
+#endif // WITH_EDITORONLY_DATA
+	return TEXT("");
+}
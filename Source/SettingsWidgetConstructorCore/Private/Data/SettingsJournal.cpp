@@ -0,0 +1,160 @@
+﻿// Copyright (c) Yevhenii Selivanov
+
+#include "Data/SettingsJournal.h"
+//---
+#include "SettingsWidgetConstructorCoreModule.h"
+//---
+#include "HAL/FileManager.h"
+#include "Misc/Crc.h"
+#include "Misc/Paths.h"
+#include "Serialization/BufferArchive.h"
+#include "Serialization/MemoryReader.h"
+
+// Closes the journal file if opened
+FSettingsJournal::~FSettingsJournal()
+{
+	Close();
+}
+
+// Returns the path of the journal file in the Saved folder of the project
+FString FSettingsJournal::GetFilename()
+{
+	return FPaths::ProjectSavedDir() / TEXT("SaveGames") / TEXT("SettingsWidgetConstructor.journal");
+}
+
+// Reads all complete records of specified journal and overrides by them specified values
+int32 FSettingsJournal::Replay(const FString& Filename, TMap<FName, FSettingValue>& InOutValues)
+{
+	const TUniquePtr<FArchive> FileReader(IFileManager::Get().CreateFileReader(*Filename, FILEREAD_Silent));
+	if (!FileReader)
+	{
+		return 0;
+	}
+
+	uint32 FileMagic = 0;
+	int32 Version = 0;
+	*FileReader << FileMagic;
+	*FileReader << Version;
+	if (FileReader->IsError()
+		|| FileMagic != Magic
+		|| Version <= 0 || Version > Latest)
+	{
+		UE_LOG(LogSettingsWidgetConstructor, Warning, TEXT("%s: the settings journal is not recognized and is ignored"), *Filename);
+		return 0;
+	}
+
+	int32 RecordsNum = 0;
+	TArray<uint8> RecordBytes;
+	while (FileReader->Tell() < FileReader->TotalSize())
+	{
+		uint32 RecordSize = 0;
+		*FileReader << RecordSize;
+		const int64 RemainingSize = FileReader->TotalSize() - FileReader->Tell();
+		if (FileReader->IsError()
+			|| RecordSize == 0
+			|| static_cast<int64>(RecordSize) + sizeof(uint32) > RemainingSize)
+		{
+			// The record was not completely written
+			break;
+		}
+
+		RecordBytes.SetNumUninitialized(RecordSize, /*bAllowShrinking*/false);
+		FileReader->Serialize(RecordBytes.GetData(), RecordSize);
+
+		uint32 Checksum = 0;
+		*FileReader << Checksum;
+		if (FileReader->IsError()
+			|| Checksum != FCrc::MemCrc32(RecordBytes.GetData(), RecordSize))
+		{
+			break;
+		}
+
+		FMemoryReader RecordReader(RecordBytes);
+		FString TagName;
+		FSettingValue Value;
+		RecordReader << TagName;
+		RecordReader << Value;
+		if (RecordReader.IsError())
+		{
+			break;
+		}
+
+		InOutValues.Emplace(*TagName, MoveTemp(Value));
+		++RecordsNum;
+	}
+
+	return RecordsNum;
+}
+
+// Opens specified journal to append new records
+bool FSettingsJournal::Open(const FString& Filename)
+{
+	Close();
+
+	FilenameInternal = Filename;
+	FileWriterInternal.Reset(IFileManager::Get().CreateFileWriter(*FilenameInternal));
+	if (!FileWriterInternal)
+	{
+		UE_LOG(LogSettingsWidgetConstructor, Warning, TEXT("%s: failed to open the settings journal, changes will be saved only on Save Settings"), *FilenameInternal);
+		return false;
+	}
+
+	WriteHeader();
+	return true;
+}
+
+// Closes the journal file, its records are kept
+void FSettingsJournal::Close()
+{
+	if (FileWriterInternal)
+	{
+		FileWriterInternal->Close();
+		FileWriterInternal.Reset();
+	}
+	RecordsNumInternal = 0;
+}
+
+// Appends the record with new value of specified setting and flushes it to disk
+void FSettingsJournal::Append(FName Tag, const FSettingValue& Value)
+{
+	if (!FileWriterInternal)
+	{
+		return;
+	}
+
+	FBufferArchive RecordWriter;
+	FString TagName = Tag.ToString();
+	RecordWriter << TagName;
+	RecordWriter << const_cast<FSettingValue&>(Value);
+
+	uint32 RecordSize = RecordWriter.Num();
+	uint32 Checksum = FCrc::MemCrc32(RecordWriter.GetData(), RecordSize);
+	*FileWriterInternal << RecordSize;
+	FileWriterInternal->Serialize(RecordWriter.GetData(), RecordSize);
+	*FileWriterInternal << Checksum;
+	FileWriterInternal->Flush();
+
+	++RecordsNumInternal;
+}
+
+// Discards all records, is called once they are compacted into the binary save
+void FSettingsJournal::Reset()
+{
+	if (!FileWriterInternal)
+	{
+		return;
+	}
+
+	// Recreate the file instead of truncating, since the writer can't be truncated
+	Open(FilenameInternal);
+}
+
+// Writes the header into just created journal file
+void FSettingsJournal::WriteHeader()
+{
+	uint32 FileMagic = Magic;
+	int32 Version = Latest;
+	*FileWriterInternal << FileMagic;
+	*FileWriterInternal << Version;
+	FileWriterInternal->Flush();
+}
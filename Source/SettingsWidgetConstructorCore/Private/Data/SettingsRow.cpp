@@ -50,6 +50,23 @@ const FSettingsDataBase* FSettingsPicker::GetChosenSettingsData() const
 	return FoundSetting;
 }
 
+// Returns the section of the Settings widget this setting is added to
+EMyVerticalAlignment FSettingsPicker::GetVerticalAlignment() const
+{
+	const FSettingsDataBase* ChosenData = GetChosenSettingsData();
+	if (ChosenData == &Button)
+	{
+		return Button.VerticalAlignment;
+	}
+
+	if (ChosenData == &TextLine)
+	{
+		return TextLine.VerticalAlignment;
+	}
+
+	return EMyVerticalAlignment::Content;
+}
+
 // Compares for equality
 bool FSettingsPicker::operator==(const FSettingsPicker& Other) const
 {
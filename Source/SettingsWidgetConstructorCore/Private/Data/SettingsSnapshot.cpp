@@ -0,0 +1,77 @@
+﻿// Copyright (c) Yevhenii Selivanov
+
+#include "Data/SettingsSnapshot.h"
+//---
+#include "Misc/ScopeRWLock.h"
+
+// Creates the snapshot of specified values
+FSettingsSnapshot::FSettingsSnapshot(uint64 InVersion, const TMap<FName, FSettingValue>& InValues)
+	: VersionInternal(InVersion)
+	, ValuesInternal(InValues) {}
+
+// Returns the bool value of specified setting or default one if the setting of this type is not found
+bool FSettingsSnapshot::GetBool(FName SettingTag, bool bDefault) const
+{
+	const FSettingValue* FoundValue = Find(SettingTag);
+	return FoundValue && FoundValue->Type == ESettingValueType::Bool ? FoundValue->BoolValue : bDefault;
+}
+
+// Returns the int value of specified setting or default one if the setting of this type is not found
+int32 FSettingsSnapshot::GetInt(FName SettingTag, int32 Default) const
+{
+	const FSettingValue* FoundValue = Find(SettingTag);
+	return FoundValue && FoundValue->Type == ESettingValueType::Int ? FoundValue->IntValue : Default;
+}
+
+// Returns the float value of specified setting or default one if the setting of this type is not found
+double FSettingsSnapshot::GetFloat(FName SettingTag, double Default) const
+{
+	const FSettingValue* FoundValue = Find(SettingTag);
+	return FoundValue && FoundValue->Type == ESettingValueType::Float ? FoundValue->FloatValue : Default;
+}
+
+// Returns the name value of specified setting or default one if the setting of this type is not found
+FName FSettingsSnapshot::GetName(FName SettingTag, FName Default) const
+{
+	const FSettingValue* FoundValue = Find(SettingTag);
+	return FoundValue && FoundValue->Type == ESettingValueType::Name ? FoundValue->NameValue : Default;
+}
+
+// Returns the latest published snapshot, is empty if nothing was published yet
+FSettingsSnapshotRef FSettingsSnapshotSource::Get() const
+{
+	FReadScopeLock ReadLock(LockInternal);
+	return CurrentInternal;
+}
+
+// Copies the value of specified setting from the latest snapshot
+bool FSettingsSnapshotSource::ReadValue(FName SettingTag, FSettingValue& OutValue) const
+{
+	// The reference keeps the snapshot alive while the value is copied, even if newer one is published meanwhile
+	const FSettingsSnapshotRef Snapshot = Get();
+	const FSettingValue* FoundValue = Snapshot->Find(SettingTag);
+	if (!FoundValue)
+	{
+		return false;
+	}
+
+	OutValue = *FoundValue;
+	return true;
+}
+
+// Publishes new snapshot with specified values, readers see it on next Get
+void FSettingsSnapshotSource::Publish(const TMap<FName, FSettingValue>& Values)
+{
+	check(IsInGameThread());
+
+	// Values are copied outside of the lock, only the swap blocks readers
+	const FSettingsSnapshotRef NewSnapshot = MakeShared<const FSettingsSnapshot, ESPMode::ThreadSafe>(Get()->GetVersion() + 1, Values);
+
+	FSettingsSnapshotRef PrevSnapshot = NewSnapshot;
+	{
+		FWriteScopeLock WriteLock(LockInternal);
+		Swap(CurrentInternal, PrevSnapshot);
+	}
+
+	// The previous snapshot is released here or by the last reader that still holds it, but never under the lock
+}
@@ -0,0 +1,17 @@
+﻿// Copyright (c) Yevhenii Selivanov
+
+#include "Data/SettingsVersionSource.h"
+//---
+#include UE_INLINE_GENERATED_CPP_BY_NAME(SettingsVersionSource)
+
+// Returns the settings version of specified object or INDEX_NONE if it does not implement this interface
+int32 ISettingsVersionSource::GetVersion(const UObject* Object)
+{
+	if (!Object
+		|| !Object->Implements<USettingsVersionSource>())
+	{
+		return INDEX_NONE;
+	}
+
+	return Execute_GetSettingsVersion(Object);
+}
@@ -32,8 +32,18 @@ UFunction* FSWCFunctionPicker::GetFunction() const
 // Compares for equality
 bool FSWCFunctionPicker::operator==(const FSWCFunctionPicker& Other) const
 {
-	return Other.FunctionClass->IsChildOf(this->FunctionClass)
-	       && Other.FunctionName == this->FunctionName;
+	if (Other.FunctionName != this->FunctionName)
+	{
+		return false;
+	}
+
+	if (!Other.FunctionClass
+		|| !this->FunctionClass)
+	{
+		return Other.FunctionClass == this->FunctionClass;
+	}
+
+	return Other.FunctionClass->IsChildOf(this->FunctionClass);
 }
 
 // Creates a hash value
@@ -24,7 +24,7 @@
   * FFunctionPicker SetMembers = FFunctionPicker::Empty;
   */
 USTRUCT(BlueprintType)
-struct SETTINGSWIDGETCONSTRUCTOR_API FSWCFunctionPicker
+struct SETTINGSWIDGETCONSTRUCTORCORE_API FSWCFunctionPicker
 {
 	GENERATED_BODY()
 
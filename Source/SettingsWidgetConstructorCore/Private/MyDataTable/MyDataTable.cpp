@@ -0,0 +1,159 @@
+﻿// Copyright (c) Yevhenii Selivanov
+
+#include "MyDataTable/SWCMyDataTable.h"
+//---
+#if WITH_EDITOR
+#include "Async/Async.h"
+#include "EditorFramework/AssetImportData.h"
+#include "Misc/FileHelper.h"
+#include "UObject/Package.h"
+#endif // WITH_EDITOR
+
+#if WITH_EDITOR
+// Called on every change in this this row
+void FSWCMyTableRow::OnDataTableChanged(const UDataTable* InDataTable, const FName InRowName)
+{
+	if (!GEditor || !GEditor->IsPlaySessionInProgress()) // Is Editor not PIE world
+	{
+		return;
+	}
+
+	if (const USWCMyDataTable* SWCMyDataTable = Cast<USWCMyDataTable>(InDataTable))
+	{
+		const uint8& ThisRowPtr = reinterpret_cast<uint8&>(*this);
+		USWCMyDataTable* DataTable = const_cast<USWCMyDataTable*>(SWCMyDataTable);
+		DataTable->OnThisDataTableChanged(InRowName, ThisRowPtr);
+	}
+}
+#endif // WITH_EDITOR
+
+// Default constructor to set RowStruct structure inherit from FSWCMyTableRow
+USWCMyDataTable::USWCMyDataTable()
+{
+	RowStruct = FSWCMyTableRow::StaticStruct();
+}
+
+#if WITH_EDITOR
+// Called on every change in this data table to reexport .json
+void USWCMyDataTable::OnThisDataTableChanged(FName RowName, const uint8& RowData)
+{
+	if (!AssetImportData)
+	{
+		return;
+	}
+
+	// Postpone the export until the table stops changing
+	LastChangeSecondsInternal = FPlatformTime::Seconds();
+	if (!ExportJSONTickerHandleInternal.IsValid())
+	{
+		const FTickerDelegate TickerDelegate = FTickerDelegate::CreateUObject(this, &ThisClass::OnExportJSONTick);
+		ExportJSONTickerHandleInternal = FTSTicker::GetCoreTicker().AddTicker(TickerDelegate, ExportJSONDelaySec);
+	}
+}
+
+// Is called by ticker to export .json once the table stopped changing
+bool USWCMyDataTable::OnExportJSONTick(float DeltaTime)
+{
+	const double SecondsSinceLastChange = FPlatformTime::Seconds() - LastChangeSecondsInternal;
+	if (SecondsSinceLastChange < ExportJSONDelaySec)
+	{
+		// Is still changing, keep waiting
+		return true;
+	}
+
+	ExportJSONTickerHandleInternal.Reset();
+	ExportJSON();
+	return false;
+}
+
+// Copies rows of the whole table into the transient snapshot on the game thread, then serializes it as .json and writes it to the file in background
+void USWCMyDataTable::ExportJSON()
+{
+	const FString CurrentFilename = AssetImportData ? AssetImportData->GetFirstFilename() : FString();
+	if (CurrentFilename.IsEmpty())
+	{
+		return;
+	}
+
+	// Copying of rows is much cheaper than their serialization, so only the copy stalls the game thread
+	UDataTable* Snapshot = NewObject<UDataTable>(GetTransientPackage(), NAME_None, RF_Transient);
+	Snapshot->RowStruct = RowStruct;
+	for (const TTuple<FName, uint8*>& RowIt : RowMap)
+	{
+		Snapshot->AddRow(RowIt.Key, RowIt.Value, RowStruct);
+	}
+	Snapshot->AddToRoot();
+
+	FPendingJSONExport& PendingExport = *PendingJSONExportInternal;
+	UDataTable* ReplacedSnapshot = nullptr;
+	{
+		FScopeLock Lock(&PendingExport.CriticalSection);
+		PendingExport.Filename = CurrentFilename;
+		ReplacedSnapshot = PendingExport.Snapshot;
+		PendingExport.Snapshot = Snapshot;
+		if (!PendingExport.bIsWriting)
+		{
+			PendingExport.bIsWriting = true;
+			Async(EAsyncExecution::ThreadPool, [PendingExportPtr = PendingJSONExportInternal]
+			{
+				FPendingJSONExport& PendingExportRef = *PendingExportPtr;
+				while (true)
+				{
+					FString Filename;
+					UDataTable* SnapshotToWrite = nullptr;
+					{
+						FScopeLock Lock(&PendingExportRef.CriticalSection);
+						if (!PendingExportRef.Snapshot)
+						{
+							PendingExportRef.bIsWriting = false;
+							break;
+						}
+						Filename = MoveTemp(PendingExportRef.Filename);
+						SnapshotToWrite = PendingExportRef.Snapshot;
+						PendingExportRef.Snapshot = nullptr;
+					}
+
+					// The snapshot is detached from the table, so it is never changed while serialized
+					const FString JSON = SnapshotToWrite->GetTableAsJSON(EDataTableExportFlags::UseJsonObjectsForStructs);
+					FFileHelper::SaveStringToFile(JSON, *Filename);
+
+					AsyncTask(ENamedThreads::GameThread, [SnapshotToWrite]
+					{
+						ReleaseJSONSnapshot(SnapshotToWrite);
+					});
+				}
+			});
+		}
+	}
+
+	if (ReplacedSnapshot)
+	{
+		// The writer in flight will pick up the latest snapshot when finishes, so the previous one is never written
+		ReleaseJSONSnapshot(ReplacedSnapshot);
+	}
+}
+
+// Frees rows of specified snapshot and lets it be garbage collected
+void USWCMyDataTable::ReleaseJSONSnapshot(UDataTable* Snapshot)
+{
+	if (!Snapshot)
+	{
+		return;
+	}
+
+	Snapshot->EmptyTable();
+	Snapshot->RemoveFromRoot();
+}
+
+// Removes the scheduled export if any
+void USWCMyDataTable::BeginDestroy()
+{
+	if (ExportJSONTickerHandleInternal.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(ExportJSONTickerHandleInternal);
+		ExportJSONTickerHandleInternal.Reset();
+	}
+
+	Super::BeginDestroy();
+}
+#endif // WITH_EDITOR
@@ -4,6 +4,10 @@
 
 #include "Engine/DataTable.h"
 //---
+#if WITH_EDITOR
+#include "Containers/Ticker.h"
+#endif // WITH_EDITOR
+//---
 #include "SWCMyDataTable.generated.h"
 
 /**
@@ -48,6 +52,39 @@ protected:
 	 * can't use UDataTable::HandleDataTableChanged() since it is not virtual.
 	 * Is in runtime module since FDataTableEditor is private. */
 	virtual void OnThisDataTableChanged(FName RowName, const uint8& RowData);
+
+	/** The delay in seconds after the last change before .json is reexported, so many edits in a row produce a single export. */
+	static constexpr float ExportJSONDelaySec = 0.5f;
+
+	/** The time of the last change, is used to postpone the export while the table keeps changing. */
+	double LastChangeSecondsInternal = 0.0;
+
+	/** The handle of the scheduled export, is valid while the export is pending. */
+	FTSTicker::FDelegateHandle ExportJSONTickerHandleInternal;
+
+	/** The detached copy of rows that is waiting to be exported as .json by the background writer.
+	 * Is shared with the writer, so the table might be destroyed while the file is written. */
+	struct FPendingJSONExport
+	{
+		FCriticalSection CriticalSection;
+		FString Filename;
+		UDataTable* Snapshot = nullptr;
+		bool bIsWriting = false;
+	};
+	TSharedRef<FPendingJSONExport, ESPMode::ThreadSafe> PendingJSONExportInternal = MakeShared<FPendingJSONExport, ESPMode::ThreadSafe>();
+
+	/** Is called by ticker to export .json once the table stopped changing. */
+	bool OnExportJSONTick(float DeltaTime);
+
+	/** Copies rows of the whole table into the transient snapshot on the game thread, then serializes it as .json and writes it to the file in background.
+	 * If previous file is still being written, the new snapshot replaces the not yet written one. */
+	void ExportJSON();
+
+	/** Frees rows of specified snapshot and lets it be garbage collected, must be called on the game thread. */
+	static void ReleaseJSONSnapshot(UDataTable* Snapshot);
+
+	/** Removes the scheduled export if any. */
+	virtual void BeginDestroy() override;
 #endif // WITH_EDITOR
 #pragma endregion OnDataTableChange
 };
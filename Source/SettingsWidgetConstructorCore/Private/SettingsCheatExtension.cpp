@@ -2,8 +2,7 @@
 
 #include "SettingsCheatExtension.h"
 //---
-#include "MyUtilsLibraries/SWCWidgetUtilsLibrary.h"
-#include "UI/SettingsWidget.h"
+#include "SettingsSubsystem.h"
 //---
 #include UE_INLINE_GENERATED_CPP_BY_NAME(SettingsCheatExtension)
 
@@ -30,8 +29,9 @@ void USettingsCheatExtension::OnCheatManagerCreated(UCheatManager* CheatManager)
 // Override the setting value with the cheat
 void USettingsCheatExtension::CheatSetting(const FString& TagByValue) const
 {
-	USettingsWidget* SettingsWidget = FSWCWidgetUtilsLibrary::FindWidgetOfClass<USettingsWidget>(GetWorld());
-	if (!SettingsWidget)
+	// Settings are changed by the subsystem, so the cheat works even if the Settings Widget was never created
+	USettingsSubsystem* SettingsSubsystem = USettingsSubsystem::Get(GetWorld());
+	if (!SettingsSubsystem)
 	{
 		return;
 	}
@@ -65,6 +65,7 @@ void USettingsCheatExtension::CheatSetting(const FString& TagByValue) const
 		TagValue = SeparatedStrings[ValueIndex];
 	}
 
-	SettingsWidget->SetSettingValue(TagName, TagValue);
-	SettingsWidget->SaveSettings();
+	SettingsSubsystem->BindSettings();
+	SettingsSubsystem->SetSettingValue(TagName, TagValue);
+	SettingsSubsystem->SaveSettings();
 }
@@ -0,0 +1,247 @@
+﻿// Copyright (c) Yevhenii Selivanov
+
+#include "SettingsProfiler.h"
+//---
+#include "Data/SettingsRow.h"
+//---
+#include "HAL/IConsoleManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+namespace SettingsProfilerCVars
+{
+	static TAutoConsoleVariable<bool> CVarEnable(
+		TEXT("SettingsWidget.Profile.Enable"),
+		false,
+		TEXT("Enables measuring of all bound getters and setters of the Settings Widget.\n")
+		TEXT("0: Disabled (default)\n")
+		TEXT("1: Enabled"),
+		ECVF_Default);
+
+	static FAutoConsoleCommandWithWorldArgsAndOutputDevice CmdDump(
+		TEXT("SettingsWidget.Profile.Dump"),
+		TEXT("Prints top N slowest bound setting functions: SettingsWidget.Profile.Dump [N] [Total|Max|Avg|Calls]"),
+		FConsoleCommandWithWorldArgsAndOutputDeviceDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World, FOutputDevice& Ar)
+		{
+			static constexpr int32 DefaultTopN = 10;
+			const int32 TopN = Args.IsValidIndex(0) && Args[0].IsNumeric() ? FCString::Atoi(*Args[0]) : DefaultTopN;
+			const FName SortBy = Args.IsValidIndex(1) ? FName(*Args[1]) : NAME_None;
+			FSettingsProfiler::Get().Dump(Ar, TopN, SortBy);
+		}));
+
+	static FAutoConsoleCommandWithWorldArgsAndOutputDevice CmdExportCSV(
+		TEXT("SettingsWidget.Profile.ExportCSV"),
+		TEXT("Writes all collected stats of bound setting functions into the .csv file: SettingsWidget.Profile.ExportCSV [Filename]"),
+		FConsoleCommandWithWorldArgsAndOutputDeviceDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World, FOutputDevice& Ar)
+		{
+			const FString WrittenFile = FSettingsProfiler::Get().ExportCSV(Args.IsValidIndex(0) ? Args[0] : TEXT(""));
+			Ar.Logf(TEXT("Settings profile %s %s"), WrittenFile.IsEmpty() ? TEXT("was not exported") : TEXT("is exported to"), *WrittenFile);
+		}));
+
+	static FAutoConsoleCommand CmdReset(
+		TEXT("SettingsWidget.Profile.Reset"),
+		TEXT("Clears all collected stats of bound setting functions."),
+		FConsoleCommandDelegate::CreateLambda([]
+		{
+			FSettingsProfiler::Get().Reset();
+		}));
+}
+
+// Adds new measured call
+void FSettingsProfilerStats::AddSample(double Seconds)
+{
+	++CallsNum;
+	TotalSeconds += Seconds;
+	MaxSeconds = FMath::Max(MaxSeconds, Seconds);
+
+	const double Microseconds = Seconds * 1000000.0;
+	for (int32 Index = 0; Index < HistogramBucketsNum; ++Index)
+	{
+		if (Microseconds < HistogramBucketsUs[Index])
+		{
+			++Histogram[Index];
+			break;
+		}
+	}
+}
+
+// Returns the profiler instance
+FSettingsProfiler& FSettingsProfiler::Get()
+{
+	static FSettingsProfiler Profiler;
+	return Profiler;
+}
+
+// Returns true if the profiler collects data
+bool FSettingsProfiler::IsEnabled()
+{
+	return SettingsProfilerCVars::CVarEnable.GetValueOnAnyThread();
+}
+
+// Adds new measured call of specified setting function
+void FSettingsProfiler::Record(const FSettingsPrimary& Primary, ESettingsProfilerFunction Function, const FSettingFunctionPicker& FunctionPicker, double Seconds)
+{
+	const FName TagName = Primary.Tag.GetTagName();
+
+	FScopeLock Lock(&StatsCriticalSection);
+
+	FSettingsProfilerStats& StatsRef = StatsInternal.FindOrAdd({TagName, Function});
+	if (StatsRef.Tag.IsNone())
+	{
+		// First call, cache the description of measured function
+		StatsRef.Tag = TagName;
+		StatsRef.Function = Function;
+		StatsRef.FunctionName = FunctionPicker.FunctionName;
+
+		const UObject* ContextObject = Primary.StaticContextObject.Get();
+		const UClass* ContextClass = ContextObject ? ContextObject->GetClass() : Primary.StaticContext.FunctionClass.Get();
+		StatsRef.ContextClassName = ContextClass ? ContextClass->GetName() : TEXT("None");
+	}
+
+	StatsRef.AddSample(Seconds);
+}
+
+// Removes all collected stats
+void FSettingsProfiler::Reset()
+{
+	FScopeLock Lock(&StatsCriticalSection);
+	StatsInternal.Empty();
+}
+
+// Returns copy of all collected stats sorted by specified predicate, the slowest first
+void FSettingsProfiler::GetSortedStats(TArray<FSettingsProfilerStats>& OutStats, FName SortBy) const
+{
+	{
+		FScopeLock Lock(&StatsCriticalSection);
+		StatsInternal.GenerateValueArray(OutStats);
+	}
+
+	static const FName MaxName = TEXT("Max");
+	static const FName AvgName = TEXT("Avg");
+	static const FName CallsName = TEXT("Calls");
+	if (SortBy == MaxName)
+	{
+		OutStats.Sort([](const FSettingsProfilerStats& A, const FSettingsProfilerStats& B) { return A.MaxSeconds > B.MaxSeconds; });
+	}
+	else if (SortBy == AvgName)
+	{
+		OutStats.Sort([](const FSettingsProfilerStats& A, const FSettingsProfilerStats& B) { return A.GetAverageSeconds() > B.GetAverageSeconds(); });
+	}
+	else if (SortBy == CallsName)
+	{
+		OutStats.Sort([](const FSettingsProfilerStats& A, const FSettingsProfilerStats& B) { return A.CallsNum > B.CallsNum; });
+	}
+	else
+	{
+		OutStats.Sort([](const FSettingsProfilerStats& A, const FSettingsProfilerStats& B) { return A.TotalSeconds > B.TotalSeconds; });
+	}
+}
+
+// Prints top N slowest functions into specified output
+void FSettingsProfiler::Dump(FOutputDevice& Ar, int32 TopN, FName SortBy) const
+{
+	TArray<FSettingsProfilerStats> SortedStats;
+	GetSortedStats(SortedStats, SortBy);
+
+	if (!IsEnabled())
+	{
+		Ar.Logf(TEXT("Settings profiler is disabled, run 'SettingsWidget.Profile.Enable 1' to collect data"));
+	}
+
+	const int32 LinesNum = FMath::Min(TopN, SortedStats.Num());
+	Ar.Logf(TEXT("Top %d of %d bound setting functions:"), LinesNum, SortedStats.Num());
+	for (int32 Index = 0; Index < LinesNum; ++Index)
+	{
+		const FSettingsProfilerStats& StatsIt = SortedStats[Index];
+		Ar.Logf(TEXT("%2d. %s [%s] %s::%s calls=%lld total=%.3fms avg=%.3fms max=%.3fms"),
+		        Index + 1,
+		        *StatsIt.Tag.ToString(),
+		        GetFunctionKindName(StatsIt.Function),
+		        *StatsIt.ContextClassName,
+		        *StatsIt.FunctionName.ToString(),
+		        StatsIt.CallsNum,
+		        StatsIt.TotalSeconds * 1000.0,
+		        StatsIt.GetAverageSeconds() * 1000.0,
+		        StatsIt.MaxSeconds * 1000.0);
+	}
+}
+
+// Writes all collected stats into the .csv file
+FString FSettingsProfiler::ExportCSV(const FString& Filename) const
+{
+	TArray<FSettingsProfilerStats> SortedStats;
+	GetSortedStats(SortedStats);
+
+	FString CSV = TEXT("Tag,Function,ContextClass,FunctionName,Calls,TotalMs,AvgMs,MaxMs");
+	for (int32 Index = 0; Index < FSettingsProfilerStats::HistogramBucketsNum; ++Index)
+	{
+		const double BucketUs = FSettingsProfilerStats::HistogramBucketsUs[Index];
+		CSV += Index + 1 < FSettingsProfilerStats::HistogramBucketsNum ? FString::Printf(TEXT(",Under%.0fus"), BucketUs) : TEXT(",Above");
+	}
+	CSV += LINE_TERMINATOR;
+
+	for (const FSettingsProfilerStats& StatsIt : SortedStats)
+	{
+		CSV += FString::Printf(TEXT("%s,%s,%s,%s,%lld,%.4f,%.4f,%.4f"),
+		                       *StatsIt.Tag.ToString(),
+		                       GetFunctionKindName(StatsIt.Function),
+		                       *StatsIt.ContextClassName,
+		                       *StatsIt.FunctionName.ToString(),
+		                       StatsIt.CallsNum,
+		                       StatsIt.TotalSeconds * 1000.0,
+		                       StatsIt.GetAverageSeconds() * 1000.0,
+		                       StatsIt.MaxSeconds * 1000.0);
+		for (const int64 BucketIt : StatsIt.Histogram)
+		{
+			CSV += FString::Printf(TEXT(",%lld"), BucketIt);
+		}
+		CSV += LINE_TERMINATOR;
+	}
+
+	const FString FilePath = !Filename.IsEmpty()
+		                         ? Filename
+		                         : FPaths::ProfilingDir() / TEXT("SettingsWidget") / FString::Printf(TEXT("SettingsProfile-%s.csv"), *FDateTime::Now().ToString());
+	return FFileHelper::SaveStringToFile(CSV, *FilePath) ? FilePath : TEXT("");
+}
+
+// Returns the display name of specified function kind
+const TCHAR* FSettingsProfiler::GetFunctionKindName(ESettingsProfilerFunction Function)
+{
+	switch (Function)
+	{
+	case ESettingsProfilerFunction::StaticContext:
+		return TEXT("StaticContext");
+	case ESettingsProfilerFunction::Getter:
+		return TEXT("Getter");
+	case ESettingsProfilerFunction::Setter:
+		return TEXT("Setter");
+	case ESettingsProfilerFunction::GetMembers:
+		return TEXT("GetMembers");
+	case ESettingsProfilerFunction::SetMembers:
+		return TEXT("SetMembers");
+	default:
+		return TEXT("None");
+	}
+}
+
+// Starts measuring the call of bound setting function
+FSettingsProfilerScope::FSettingsProfilerScope(const FSettingsPrimary& InPrimary, ESettingsProfilerFunction InFunction, const FSettingFunctionPicker& InFunctionPicker)
+{
+	if (FSettingsProfiler::IsEnabled())
+	{
+		Primary = &InPrimary;
+		FunctionPicker = &InFunctionPicker;
+		Function = InFunction;
+		StartCycles = FPlatformTime::Cycles64();
+	}
+}
+
+// Finishes measuring the call of bound setting function
+FSettingsProfilerScope::~FSettingsProfilerScope()
+{
+	if (Primary && FunctionPicker)
+	{
+		const double Seconds = FPlatformTime::ToSeconds64(FPlatformTime::Cycles64() - StartCycles);
+		FSettingsProfiler::Get().Record(*Primary, Function, *FunctionPicker, Seconds);
+	}
+}
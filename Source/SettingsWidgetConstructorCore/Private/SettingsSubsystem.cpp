@@ -0,0 +1,2623 @@
+﻿// Copyright (c) Yevhenii Selivanov
+
+#include "SettingsSubsystem.h"
+//---
+#include "Data/SettingsBinarySave.h"
+#include "Data/SettingsCoreDataAsset.h"
+#include "Data/SettingsJournal.h"
+#include "Data/SettingsDataTable.h"
+#include "Data/SettingsVersionSource.h"
+#include "SettingsProfiler.h"
+#include "SettingsWidgetConstructorCoreModule.h"
+//---
+#include "Async/ParallelFor.h"
+#include "Async/TaskGraphInterfaces.h"
+#include "Containers/Ticker.h"
+#include "Engine/Engine.h"
+#include "Engine/GameInstance.h"
+#include "Engine/World.h"
+#include "GameFramework/GameUserSettings.h"
+#include "HAL/IConsoleManager.h"
+//---
+#include UE_INLINE_GENERATED_CPP_BY_NAME(SettingsSubsystem)
+
+namespace SettingsSubsystemCommands
+{
+	static FAutoConsoleCommandWithWorldArgsAndOutputDevice CmdBenchmarkGetters(
+		TEXT("SettingsWidget.Benchmark.Getters"),
+		TEXT("Measures parallel evaluation of thread-safe getters across workers: SettingsWidget.Benchmark.Getters [RowsMultiplier] [Iterations]"),
+		FConsoleCommandWithWorldArgsAndOutputDeviceDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World, FOutputDevice& Ar)
+		{
+			USettingsSubsystem* SettingsSubsystem = USettingsSubsystem::Get(World);
+			if (!SettingsSubsystem)
+			{
+				Ar.Log(TEXT("Settings Subsystem is not available, start the game first"));
+				return;
+			}
+
+			static constexpr int32 DefaultRowsMultiplier = 10;
+			static constexpr int32 DefaultIterations = 10;
+			const int32 RowsMultiplier = Args.IsValidIndex(0) && Args[0].IsNumeric() ? FCString::Atoi(*Args[0]) : DefaultRowsMultiplier;
+			const int32 Iterations = Args.IsValidIndex(1) && Args[1].IsNumeric() ? FCString::Atoi(*Args[1]) : DefaultIterations;
+
+			SettingsSubsystem->BindSettings();
+			SettingsSubsystem->BenchmarkGetters(Ar, FMath::Max(RowsMultiplier, 1), FMath::Max(Iterations, 1));
+		}));
+}
+
+// Returns the settings subsystem of the game instance of specified world context, is null if there is no game instance
+USettingsSubsystem* USettingsSubsystem::Get(const UObject* WorldContextObject)
+{
+	const UWorld* World = GEngine ? GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull) : nullptr;
+	const UGameInstance* GameInstance = World ? World->GetGameInstance() : nullptr;
+	return GameInstance ? GameInstance->GetSubsystem<ThisClass>() : nullptr;
+}
+
+// Is called when the game instance is initialized, caches setting rows without binding them
+void USettingsSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	const USettingsCoreDataAsset& CoreDataAsset = USettingsCoreDataAsset::Get();
+	if (!CoreDataAsset.GetSettingsDataTable())
+	{
+		return;
+	}
+
+	UpdateSettingsTableRows();
+
+	bStageChangesInternal = CoreDataAsset.IsStageChanges();
+
+	if (CoreDataAsset.IsUseBinarySave())
+	{
+		FSettingsBinarySave::LoadFromFile(FSettingsBinarySave::GetFilename(), /*Out*/SavedValuesInternal);
+
+		if (CoreDataAsset.IsUseJournal())
+		{
+			OpenJournal();
+		}
+	}
+
+	FCoreUObjectDelegates::PreLoadMap.AddUObject(this, &ThisClass::OnPreLoadMap);
+	SnapshotTickerInternal = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateUObject(this, &ThisClass::TickSnapshot));
+
+	if (CoreDataAsset.IsApplySettingsOnBoot())
+	{
+		// Apply settings of already available objects like Game User Settings, the rest is applied when the map is loaded
+		ApplySettingsOnBoot();
+		FCoreUObjectDelegates::PostLoadMapWithWorld.AddUObject(this, &ThisClass::OnPostLoadMapWithWorld);
+	}
+}
+
+// Is called when the game instance is shutting down
+void USettingsSubsystem::Deinitialize()
+{
+	FCoreUObjectDelegates::PostLoadMapWithWorld.RemoveAll(this);
+	FCoreUObjectDelegates::PreLoadMap.RemoveAll(this);
+	FTSTicker::GetCoreTicker().RemoveTicker(NextFrameTickerInternal);
+	CancelAsyncGetters();
+	CancelAsyncSetters();
+
+	// Workers that still hold the snapshot source of this game instance should not read its values, other instances are not affected
+	FTSTicker::GetCoreTicker().RemoveTicker(SnapshotTickerInternal);
+	SnapshotValuesInternal.Empty();
+	PublishSnapshot();
+
+	if (JournalInternal.IsOpened())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(CompactJournalTickerInternal);
+		CompactJournal();
+		JournalInternal.Close();
+	}
+
+	Super::Deinitialize();
+}
+
+// Is called right before the map is loaded to apply queued settings that take effect on level load
+void USettingsSubsystem::OnPreLoadMap(const FString& MapName)
+{
+	FlushQueuedSettings(ESettingExecution::OnLevelLoad);
+}
+
+// Is called after the map is loaded to apply settings which Static Context object was created by this map
+void USettingsSubsystem::OnPostLoadMapWithWorld(UWorld* LoadedWorld)
+{
+	if (!LoadedWorld
+		|| LoadedWorld->GetGameInstance() != GetGameInstance())
+	{
+		return;
+	}
+
+	ApplySettingsOnBoot();
+}
+
+// Try to find the setting row
+const FSettingsPicker& USettingsSubsystem::FindSettingRow(FName PotentialTagName) const
+{
+	if (PotentialTagName.IsNone())
+	{
+		return FSettingsPicker::Empty;
+	}
+
+	const FSettingsPicker* FoundRow = &FSettingsPicker::Empty;
+
+	// Find row by specified substring
+	const FString TagSubString(PotentialTagName.ToString());
+	for (const TTuple<FName, FSettingsPicker>& RowIt : SettingsTableRowsInternal)
+	{
+		const FString TagStringIt(RowIt.Key.ToString());
+		if (TagStringIt.Contains(TagSubString))
+		{
+			FoundRow = &RowIt.Value;
+			break;
+		}
+	}
+
+	return *FoundRow;
+}
+
+// Returns the found row by specified tag
+const FSettingsPicker& USettingsSubsystem::GetSettingRow(const FSettingTag& SettingTag) const
+{
+	if (!SettingTag.IsValid())
+	{
+		return FSettingsPicker::Empty;
+	}
+
+	const FSettingsPicker* FoundRow = SettingsTableRowsInternal.Find(SettingTag.GetTagName());
+	return FoundRow ? *FoundRow : FSettingsPicker::Empty;
+}
+
+// Returns the dense id assigned to specified setting when the Settings Data Table was loaded
+uint16 USettingsSubsystem::GetSettingId(const FSettingTag& SettingTag) const
+{
+	const uint16* FoundId = SettingTag.IsValid() ? SettingIdsInternal.Find(SettingTag.GetTagName()) : nullptr;
+	return FoundId ? *FoundId : InvalidSettingId;
+}
+
+// Returns the tag of the setting by its dense id
+const FSettingTag& USettingsSubsystem::GetSettingTagById(uint16 SettingId) const
+{
+	return SettingRowsByIdInternal.IsValidIndex(SettingId) ? SettingRowsByIdInternal[SettingId]->PrimaryData.Tag : FSettingTag::EmptySettingTag;
+}
+
+// Converts specified tags into the bitset by ids of all settings that match any of them
+void USettingsSubsystem::GetSettingsBits(const FGameplayTagContainer& Settings, TBitArray<>& OutBits) const
+{
+	OutBits.Init(false, SettingRowsByIdInternal.Num());
+	for (const FGameplayTag& TagIt : Settings)
+	{
+		if (const TBitArray<>* TagBits = SettingsBitsByTagInternal.Find(TagIt.GetTagName()))
+		{
+			OutBits.CombineWithBitwiseOR(*TagBits, EBitwiseOperatorFlags::MaxSize);
+		}
+	}
+}
+
+// Returns the bitset by ids of settings that are updated by specified setting
+const TBitArray<>& USettingsSubsystem::GetSettingsToUpdateBits(const FSettingTag& SettingTag) const
+{
+	static const TBitArray<> EmptyBits;
+	const uint16 SettingId = GetSettingId(SettingTag);
+	return SettingsToUpdateBitsInternal.IsValidIndex(SettingId) ? SettingsToUpdateBitsInternal[SettingId] : EmptyBits;
+}
+
+// Caches setting rows from the Settings Data Table
+void USettingsSubsystem::UpdateSettingsTableRows()
+{
+	const USettingsDataTable* SettingsDataTable = USettingsCoreDataAsset::Get().GetSettingsDataTable();
+	if (!ensureMsgf(SettingsDataTable, TEXT("ASSERT: 'SettingsDataTable' is not valid")))
+	{
+		return;
+	}
+
+	TMap<FName, FSettingsRow> SettingRows;
+	SettingsDataTable->GetSettingRows(/*Out*/SettingRows);
+	if (!ensureMsgf(!SettingRows.IsEmpty(), TEXT("ASSERT: 'SettingRows' are empty"))
+		|| !ensureMsgf(SettingRows.Num() < InvalidSettingId, TEXT("ASSERT: 'SettingRows' has more rows than ids: %d"), SettingRows.Num()))
+	{
+		return;
+	}
+
+	// Reset values if currently are set
+	CancelAsyncGetters();
+	CancelAsyncSetters();
+	SettingsTableRowsInternal.Empty();
+	GetterCacheInternal.Empty();
+	SettingIdsInternal.Empty();
+	SettingRowsByIdInternal.Empty();
+	GetterCachesByIdInternal.Empty();
+	SettingsToUpdateBitsInternal.Empty();
+	SettingsBitsByTagInternal.Empty();
+	TagsByFunctionInternal.Empty();
+	TagsByContextInternal.Empty();
+	CustomWidgetsInternal.Empty();
+	SnapshotValuesInternal.Empty();
+	bIsSnapshotDirtyInternal = true;
+	DefaultValuesInternal.Empty();
+	PendingValuesInternal.Empty();
+	QueuedValuesInternal.Empty();
+
+	SettingsTableRowsInternal.Reserve(SettingRows.Num());
+	GetterCacheInternal.Reserve(SettingRows.Num());
+	SettingIdsInternal.Reserve(SettingRows.Num());
+	SettingRowsByIdInternal.Reserve(SettingRows.Num());
+	GetterCachesByIdInternal.Reserve(SettingRows.Num());
+	for (const TTuple<FName, FSettingsRow>& SettingRowIt : SettingRows)
+	{
+		FSettingsPicker& Setting = SettingsTableRowsInternal.Emplace(SettingRowIt.Key, SettingRowIt.Value.SettingsPicker);
+		FSettingsGetterCache& GetterCache = GetterCacheInternal.Emplace(SettingRowIt.Key);
+
+		// Both maps are reserved, so their values are never moved by next rows
+		SettingIdsInternal.Emplace(SettingRowIt.Key, static_cast<uint16>(SettingRowsByIdInternal.Num()));
+		SettingRowsByIdInternal.Emplace(&Setting);
+		GetterCachesByIdInternal.Emplace(&GetterCache);
+
+		for (const FName FunctionNameIt : {Setting.PrimaryData.Getter.FunctionName, Setting.PrimaryData.Setter.FunctionName})
+		{
+			if (!FunctionNameIt.IsNone())
+			{
+				TagsByFunctionInternal.AddUnique(FunctionNameIt, SettingRowIt.Key);
+			}
+		}
+	}
+
+	// Ids of all rows are known only now, so bitsets are built after all rows are added
+	const int32 SettingIdsNum = SettingRowsByIdInternal.Num();
+	for (int32 SettingId = 0; SettingId < SettingIdsNum; ++SettingId)
+	{
+		// The setting matches its own tag and all its parents, so walk them once instead of matching each tag against all rows
+		for (FGameplayTag TagIt = SettingRowsByIdInternal[SettingId]->PrimaryData.Tag; TagIt.IsValid(); TagIt = TagIt.RequestDirectParent())
+		{
+			TBitArray<>& TagBits = SettingsBitsByTagInternal.FindOrAdd(TagIt.GetTagName());
+			if (TagBits.Num() == 0)
+			{
+				TagBits.Init(false, SettingIdsNum);
+			}
+			TagBits[SettingId] = true;
+		}
+	}
+
+	SettingsToUpdateBitsInternal.SetNum(SettingIdsNum);
+	for (int32 SettingId = 0; SettingId < SettingRowsByIdInternal.Num(); ++SettingId)
+	{
+		GetSettingsBits(SettingRowsByIdInternal[SettingId]->PrimaryData.SettingsToUpdate, /*Out*/SettingsToUpdateBitsInternal[SettingId]);
+	}
+}
+
+// Binds getters and setters of all settings which Static Context object is not bound yet or was destroyed
+void USettingsSubsystem::BindSettings()
+{
+	if (SettingsTableRowsInternal.IsEmpty())
+	{
+		UpdateSettingsTableRows();
+	}
+
+	FGameplayTagContainer BoundSettings;
+	for (TTuple<FName, FSettingsPicker>& RowIt : SettingsTableRowsInternal)
+	{
+		FSettingsPicker& Setting = RowIt.Value;
+		if (Setting.PrimaryData.StaticContextObject.IsValid()
+			|| !Setting.GetChosenSettingsData())
+		{
+			// Is already bound or is not a setting
+			continue;
+		}
+
+		if (BindSetting(Setting))
+		{
+			BoundSettings.AddTag(Setting.PrimaryData.Tag);
+			ApplyPersistedValue(Setting, SavedValuesInternal.Find(RowIt.Key), /*Out*/DefaultValuesInternal.FindOrAdd(RowIt.Key));
+		}
+	}
+
+	// Take current values of just bound settings from their getters
+	UpdateSettings(BoundSettings);
+	RecordSourceVersions(BoundSettings);
+	CaptureSnapshotValues(BoundSettings);
+}
+
+// Binds all settings which Static Context object is available and applies values persisted in its configs
+void USettingsSubsystem::ApplySettingsOnBoot()
+{
+	if (SettingsTableRowsInternal.IsEmpty())
+	{
+		UpdateSettingsTableRows();
+	}
+
+	TArray<FName> BoundSettings;
+	FGameplayTagContainer BoundSettingsTags;
+	for (TTuple<FName, FSettingsPicker>& RowIt : SettingsTableRowsInternal)
+	{
+		FSettingsPicker& Setting = RowIt.Value;
+		if (Setting.PrimaryData.StaticContextObject.IsValid()
+			|| !Setting.GetChosenSettingsData())
+		{
+			// Is already bound or is not a setting
+			continue;
+		}
+
+		if (BindSetting(Setting))
+		{
+			BoundSettings.Emplace(RowIt.Key);
+			BoundSettingsTags.AddTag(Setting.PrimaryData.Tag);
+		}
+	}
+
+	if (BoundSettings.IsEmpty())
+	{
+		return;
+	}
+
+	// Add all default values before applying, so concurrently written values are never reallocated
+	DefaultValuesInternal.Reserve(DefaultValuesInternal.Num() + BoundSettings.Num());
+	for (const FName SettingIt : BoundSettings)
+	{
+		DefaultValuesInternal.FindOrAdd(SettingIt);
+	}
+
+	TArray<TArray<FName>> Waves;
+	GetSettingsApplyWaves(BoundSettings, /*Out*/Waves);
+
+	for (const TArray<FName>& WaveIt : Waves)
+	{
+		// Settings of the same object are applied in a row, so only different objects are applied concurrently
+		TMap<const UObject*, TArray<FName>> SettingsByContext;
+		for (const FName SettingIt : WaveIt)
+		{
+			const FSettingsPicker& Setting = SettingsTableRowsInternal.FindChecked(SettingIt);
+			SettingsByContext.FindOrAdd(Setting.PrimaryData.StaticContextObject.Get()).Emplace(SettingIt);
+		}
+
+		const auto ApplyGroup = [this](const TArray<FName>& Group)
+		{
+			for (const FName SettingIt : Group)
+			{
+				ApplyPersistedValue(SettingsTableRowsInternal.FindChecked(SettingIt), SavedValuesInternal.Find(SettingIt), DefaultValuesInternal.FindChecked(SettingIt));
+			}
+		};
+
+		TArray<const TArray<FName>*> ThreadSafeGroups;
+		for (const TTuple<const UObject*, TArray<FName>>& GroupIt : SettingsByContext)
+		{
+			const bool bIsThreadSafe = !GroupIt.Value.ContainsByPredicate([this](FName SettingIt) { return !SettingsTableRowsInternal.FindChecked(SettingIt).PrimaryData.bIsThreadSafe; });
+			if (bIsThreadSafe)
+			{
+				ThreadSafeGroups.Emplace(&GroupIt.Value);
+				continue;
+			}
+
+			ApplyGroup(GroupIt.Value);
+		}
+
+		ParallelFor(ThreadSafeGroups.Num(), [&ThreadSafeGroups, &ApplyGroup](int32 Index)
+		{
+			ApplyGroup(*ThreadSafeGroups[Index]);
+		});
+	}
+
+	// Setters were called directly, so values cached by getters before are outdated
+	InvalidateSettingsCache(BoundSettingsTags);
+
+	// Bound settings are skipped by Bind Settings, so take their applied values from getters right away
+	for (const FName SettingIt : BoundSettings)
+	{
+		FSettingsPicker& Setting = SettingsTableRowsInternal.FindChecked(SettingIt);
+		SetCachedValue(Setting, GetSettingTypedValue(Setting.PrimaryData.Tag));
+	}
+
+	RecordSourceVersions(BoundSettingsTags);
+	CaptureSnapshotValues(BoundSettingsTags);
+}
+
+// Save all settings into their configs
+void USettingsSubsystem::SaveSettings()
+{
+	FlushAsyncSetters();
+	ApplyPendingSettings();
+
+	// Store values that take effect after restart
+	FlushQueuedSettings(ESettingExecution::OnRestart);
+
+	ApplySettings();
+
+	if (USettingsCoreDataAsset::Get().IsUseBinarySave())
+	{
+		CompactJournal();
+		return;
+	}
+
+	for (const TTuple<FName, FSettingsPicker>& RowIt : SettingsTableRowsInternal)
+	{
+		if (UObject* ContextObject = RowIt.Value.PrimaryData.StaticContextObject.Get())
+		{
+			ContextObject->SaveConfig();
+		}
+	}
+}
+
+// Writes values of settings that differ from their defaults into the binary save
+bool USettingsSubsystem::SaveBinarySettings()
+{
+	// Keep saved values of settings that are not bound yet, e.g: their Static Context object is not created on this map
+	TMap<FName, FSettingValue> NewSavedValues = SavedValuesInternal;
+	for (const TTuple<FName, FSettingValue>& DefaultValueIt : DefaultValuesInternal)
+	{
+		if (PendingValuesInternal.Contains(DefaultValueIt.Key))
+		{
+			// Is not applied yet, so keep previously saved value
+			continue;
+		}
+
+		const FSettingsPicker* Setting = SettingsTableRowsInternal.Find(DefaultValueIt.Key);
+		const FSettingValue CurrentValue = Setting ? GetSettingTypedValue(Setting->PrimaryData.Tag) : FSettingValue::Empty;
+		if (CurrentValue.IsValid()
+			&& CurrentValue != DefaultValueIt.Value)
+		{
+			NewSavedValues.Emplace(DefaultValueIt.Key, CurrentValue);
+		}
+		else
+		{
+			NewSavedValues.Remove(DefaultValueIt.Key);
+		}
+	}
+
+	if (NewSavedValues.OrderIndependentCompareEqual(SavedValuesInternal))
+	{
+		// Nothing was changed
+		return true;
+	}
+
+	if (!FSettingsBinarySave::SaveToFile(FSettingsBinarySave::GetFilename(), NewSavedValues))
+	{
+		return false;
+	}
+
+	SavedValuesInternal = MoveTemp(NewSavedValues);
+	return true;
+}
+
+// Replays the journal left by previous session over the binary save and opens it to record new changes
+void USettingsSubsystem::OpenJournal()
+{
+	const FString JournalFilename = FSettingsJournal::GetFilename();
+	const int32 ReplayedNum = FSettingsJournal::Replay(JournalFilename, /*InOut*/SavedValuesInternal);
+	if (ReplayedNum > 0)
+	{
+		// Changes of previous session were not saved, e.g: the game crashed, so keep them before the journal is discarded
+		UE_LOG(LogSettingsWidgetConstructor, Log, TEXT("Recovered %d settings changes from the journal"), ReplayedNum);
+		if (!FSettingsBinarySave::SaveToFile(FSettingsBinarySave::GetFilename(), SavedValuesInternal))
+		{
+			return;
+		}
+	}
+
+	if (!JournalInternal.Open(JournalFilename))
+	{
+		return;
+	}
+
+	const float CompactionInterval = USettingsCoreDataAsset::Get().GetJournalCompactionInterval();
+	if (CompactionInterval > 0.f)
+	{
+		CompactJournalTickerInternal = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateWeakLambda(this, [this](float DeltaTime)
+		{
+			CompactJournal();
+			return true;
+		}), CompactionInterval);
+	}
+}
+
+// Writes all journaled changes into the binary save and discards the journal
+void USettingsSubsystem::CompactJournal()
+{
+	if (JournalInternal.IsOpened()
+		&& JournalInternal.GetRecordsNum() == 0)
+	{
+		// Nothing was changed since last compaction
+		return;
+	}
+
+	if (SaveBinarySettings())
+	{
+		JournalInternal.Reset();
+	}
+}
+
+// Keeps the value of specified setting as pending or queues it by its execution instead of calling its setter
+bool USettingsSubsystem::StageSettingValue(const FSettingsPicker& Setting, const FSettingValue& Value)
+{
+	if (bIsExecutingInternal)
+	{
+		// Dependent settings of applied values are set right away
+		return false;
+	}
+
+	const FSettingsPrimary& Primary = Setting.PrimaryData;
+	const FSettingTag& SettingTag = Primary.Tag;
+	const bool bIsStaged = Primary.Execution == ESettingExecution::OnApply
+		|| (bStageChangesInternal && !Primary.bIsLive);
+	if (bIsStaged)
+	{
+		PendingValuesInternal.Emplace(SettingTag.GetTagName(), Value);
+	}
+	else if (Primary.Execution == ESettingExecution::Async)
+	{
+		if (!Primary.bIsThreadSafe)
+		{
+			// Setter can't be called outside of the game thread
+			return false;
+		}
+
+		// Settings To Update are updated only once the setter completes
+		ExecuteSetterAsync(Setting, Value);
+		return true;
+	}
+	else if (Primary.Execution != ESettingExecution::Immediate)
+	{
+		QueueSettingValue(Setting, Value);
+	}
+	else
+	{
+		return false;
+	}
+
+	// Let dependent settings preview the pending value
+	UpdateSettingsByIds(GetSettingsToUpdateBits(Setting.PrimaryData.Tag));
+
+	OnSettingChanged.Broadcast(SettingTag);
+	return true;
+}
+
+// Returns the pending or queued value of specified setting and type or null if it is not staged
+const FSettingValue* USettingsSubsystem::FindPendingValue(const FSettingTag& SettingTag, ESettingValueType Type) const
+{
+	if ((PendingValuesInternal.IsEmpty() && QueuedValuesInternal.IsEmpty() && InFlightValuesInternal.IsEmpty())
+		|| !SettingTag.IsValid())
+	{
+		return nullptr;
+	}
+
+	const FName TagName = SettingTag.GetTagName();
+	const FSettingValue* PendingValue = PendingValuesInternal.Find(TagName);
+	if (!PendingValue)
+	{
+		PendingValue = QueuedValuesInternal.Find(TagName);
+	}
+	if (!PendingValue)
+	{
+		PendingValue = InFlightValuesInternal.Find(TagName);
+	}
+	return PendingValue && PendingValue->Type == Type ? PendingValue : nullptr;
+}
+
+// Queues the value of specified setting to be applied by its execution, the previous queued value is replaced
+void USettingsSubsystem::QueueSettingValue(const FSettingsPicker& Setting, const FSettingValue& Value)
+{
+	const FSettingsPrimary& Primary = Setting.PrimaryData;
+	const FName TagName = Primary.Tag.GetTagName();
+	if (Primary.Execution == ESettingExecution::OnRestart
+		&& !RunningValuesInternal.Contains(TagName))
+	{
+		// Remember the value the game runs with before it is replaced by the queued one
+		RunningValuesInternal.Emplace(TagName, GetSettingTypedValue(Primary.Tag));
+	}
+
+	QueuedValuesInternal.Emplace(TagName, Value);
+
+	if (Primary.Execution == ESettingExecution::NextFrame
+		&& !NextFrameTickerInternal.IsValid())
+	{
+		NextFrameTickerInternal = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateWeakLambda(this, [this](float DeltaTime)
+		{
+			NextFrameTickerInternal.Reset();
+			FlushQueuedSettings(ESettingExecution::NextFrame);
+			return false;
+		}));
+	}
+	else if (Primary.Execution == ESettingExecution::OnRestart)
+	{
+		// The restart is required only if the value differs from the one the game runs with
+		const bool bIsRestartRequired = RunningValuesInternal.FindChecked(TagName) != Value;
+		const bool bWasRestartRequired = RestartRequiredSettingsInternal.Contains(TagName);
+		if (bIsRestartRequired != bWasRestartRequired)
+		{
+			if (bIsRestartRequired)
+			{
+				RestartRequiredSettingsInternal.Emplace(TagName);
+			}
+			else
+			{
+				RestartRequiredSettingsInternal.Remove(TagName);
+			}
+			OnRestartRequiredChanged.Broadcast(Primary.Tag, bIsRestartRequired);
+		}
+	}
+}
+
+// Calls the setter of specified async setting in background
+void USettingsSubsystem::ExecuteSetterAsync(const FSettingsPicker& Setting, const FSettingValue& Value)
+{
+	const FSettingTag& SettingTag = Setting.PrimaryData.Tag;
+	const FName TagName = SettingTag.GetTagName();
+	InFlightValuesInternal.Emplace(TagName, Value);
+	RecordSettingChange(SettingTag, Value);
+
+	if (SetterTasksInternal.Contains(TagName))
+	{
+		// Latest value wins, it is set once the running setter completes
+		SupersededSettersInternal.Emplace(TagName);
+		return;
+	}
+
+	// The row is copied, so the game thread can rebind or change it while the setter is running
+	SetterTasksInternal.Emplace(TagName, UE::Tasks::Launch(UE_SOURCE_LOCATION, [Setting, Value]
+	{
+		ExecuteSetter(Setting, Value);
+	}));
+
+	if (!AsyncSettersTickerInternal.IsValid())
+	{
+		AsyncSettersTickerInternal = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateUObject(this, &ThisClass::TickAsyncSetters));
+	}
+
+	OnSettingInFlightChanged.Broadcast(SettingTag, true);
+}
+
+// Invalidates and updates dependent settings of completed async setters in one batch
+bool USettingsSubsystem::TickAsyncSetters(float DeltaTime)
+{
+	TMap<FName, FSettingValue> CompletedValues;
+	TBitArray<> SettingsToUpdate(false, GetSettingIdsNum());
+	for (TMap<FName, UE::Tasks::FTask>::TIterator It(SetterTasksInternal); It; ++It)
+	{
+		if (!It.Value().IsCompleted())
+		{
+			continue;
+		}
+
+		const FName TagName = It.Key();
+		const FSettingsPicker& Setting = SettingsTableRowsInternal.FindChecked(TagName);
+		if (SupersededSettersInternal.Remove(TagName) > 0)
+		{
+			// Set the latest value right after the previous setter, so setters of one setting never run concurrently
+			It.Value() = UE::Tasks::Launch(UE_SOURCE_LOCATION, [Setting, Value = InFlightValuesInternal.FindChecked(TagName)]
+			{
+				ExecuteSetter(Setting, Value);
+			});
+			continue;
+		}
+
+		It.RemoveCurrent();
+		InFlightValuesInternal.RemoveAndCopyValue(TagName, /*Out*/CompletedValues.Emplace(TagName));
+		InvalidateSettingCache(Setting.PrimaryData.Tag);
+		SettingsToUpdate.CombineWithBitwiseOR(GetSettingsToUpdateBits(Setting.PrimaryData.Tag), EBitwiseOperatorFlags::MaxSize);
+	}
+
+	UpdateSettingsByIds(SettingsToUpdate);
+
+	for (const TTuple<FName, FSettingValue>& CompletedIt : CompletedValues)
+	{
+		const FSettingTag& SettingTag = SettingsTableRowsInternal.FindChecked(CompletedIt.Key).PrimaryData.Tag;
+		OnSettingValueCommitted(SettingTag, CompletedIt.Value);
+		OnSettingChanged.Broadcast(SettingTag);
+		OnSettingInFlightChanged.Broadcast(SettingTag, false);
+	}
+
+	const bool bHasAsyncSetters = !SetterTasksInternal.IsEmpty();
+	if (!bHasAsyncSetters)
+	{
+		AsyncSettersTickerInternal.Reset();
+	}
+	return bHasAsyncSetters;
+}
+
+// Waits for all running async setters without propagation
+void USettingsSubsystem::CancelAsyncSetters()
+{
+	FTSTicker::GetCoreTicker().RemoveTicker(AsyncSettersTickerInternal);
+	AsyncSettersTickerInternal.Reset();
+
+	for (TTuple<FName, UE::Tasks::FTask>& TaskIt : SetterTasksInternal)
+	{
+		TaskIt.Value.Wait();
+	}
+
+	SetterTasksInternal.Empty();
+	InFlightValuesInternal.Empty();
+	SupersededSettersInternal.Empty();
+}
+
+// Calls real setters of specified values in order of their Settings To Update, then updates their dependent settings
+void USettingsSubsystem::ExecuteSettingValues(const TMap<FName, FSettingValue>& Values, bool bIsApplying)
+{
+	if (Values.IsEmpty())
+	{
+		return;
+	}
+
+	TArray<FName> Settings;
+	Values.GenerateKeyArray(/*Out*/Settings);
+	TArray<TArray<FName>> Waves;
+	GetSettingsApplyWaves(Settings, /*Out*/Waves);
+
+	TBitArray<> SettingsToUpdate(false, GetSettingIdsNum());
+	for (const TArray<FName>& WaveIt : Waves)
+	{
+		for (const FName SettingIt : WaveIt)
+		{
+			const FSettingsPicker& Setting = SettingsTableRowsInternal.FindChecked(SettingIt);
+			const FSettingValue& Value = Values.FindChecked(SettingIt);
+			ExecuteSetter(Setting, Value);
+			InvalidateSettingCache(Setting.PrimaryData.Tag);
+			RecordSettingChange(Setting.PrimaryData.Tag, Value);
+			SettingsToUpdate.CombineWithBitwiseOR(GetSettingsToUpdateBits(Setting.PrimaryData.Tag), EBitwiseOperatorFlags::MaxSize);
+		}
+	}
+
+	{
+		// Dependent settings are updated by real values, so have to be set right away on applying
+		TGuardValue<bool> ExecutingGuard(bIsExecutingInternal, bIsExecutingInternal || bIsApplying);
+		UpdateSettingsByIds(SettingsToUpdate);
+	}
+
+	for (const FName SettingIt : Settings)
+	{
+		const FSettingTag& SettingTag = SettingsTableRowsInternal.FindChecked(SettingIt).PrimaryData.Tag;
+		OnSettingValueCommitted(SettingTag, Values.FindChecked(SettingIt));
+		OnSettingChanged.Broadcast(SettingTag);
+	}
+}
+
+// Sets the value shown by UI of specified setting without calling its setter
+void USettingsSubsystem::SetCachedValue(FSettingsPicker& Setting, const FSettingValue& Value)
+{
+	switch (Value.Type)
+	{
+	case ESettingValueType::Bool:
+		Setting.Checkbox.bIsSet = Value.BoolValue;
+		break;
+	case ESettingValueType::Int:
+		Setting.Combobox.ChosenMemberIndex = Value.IntValue;
+		break;
+	case ESettingValueType::Float:
+		Setting.Slider.ChosenValue = Value.FloatValue;
+		break;
+	case ESettingValueType::Name:
+		Setting.UserInput.UserInput = Value.NameValue;
+		break;
+	case ESettingValueType::Text:
+		Setting.PrimaryData.Caption = Value.TextValue;
+		break;
+	case ESettingValueType::Members:
+		Setting.Combobox.Members = Value.MembersValue;
+		break;
+	default:
+		break;
+	}
+}
+
+// Returns the value shown by UI of specified setting
+FSettingValue USettingsSubsystem::GetCachedValue(const FSettingsPicker& Setting)
+{
+	const FSettingsDataBase* ChosenData = Setting.GetChosenSettingsData();
+	if (ChosenData == &Setting.Checkbox)
+	{
+		return FSettingValue::MakeBool(Setting.Checkbox.bIsSet);
+	}
+
+	if (ChosenData == &Setting.Combobox)
+	{
+		return FSettingValue::MakeInt(Setting.Combobox.ChosenMemberIndex);
+	}
+
+	if (ChosenData == &Setting.Slider)
+	{
+		return FSettingValue::MakeFloat(Setting.Slider.ChosenValue);
+	}
+
+	if (ChosenData == &Setting.UserInput)
+	{
+		return FSettingValue::MakeName(Setting.UserInput.UserInput);
+	}
+
+	if (ChosenData == &Setting.TextLine)
+	{
+		return FSettingValue::MakeText(Setting.PrimaryData.Caption);
+	}
+
+	return FSettingValue::Empty;
+}
+
+// Appends new value of the setting to the journal, so the change is not lost if the game crashes before settings are saved
+void USettingsSubsystem::RecordSettingChange(const FSettingTag& SettingTag, const FSettingValue& Value)
+{
+	if (JournalInternal.IsOpened())
+	{
+		JournalInternal.Append(SettingTag.GetTagName(), Value);
+	}
+}
+
+// Enables or disables staging of changed values
+void USettingsSubsystem::SetStageChanges(bool bInStageChanges)
+{
+	if (bStageChangesInternal == bInStageChanges)
+	{
+		return;
+	}
+
+	if (!bInStageChanges)
+	{
+		ApplyPendingSettings();
+	}
+
+	bStageChangesInternal = bInStageChanges;
+}
+
+// Calls real setters of all staged values in one batch
+void USettingsSubsystem::ApplyPendingSettings()
+{
+	if (PendingValuesInternal.IsEmpty())
+	{
+		return;
+	}
+
+	TMap<FName, FSettingValue> PendingValues = MoveTemp(PendingValuesInternal);
+	PendingValuesInternal.Reset();
+
+	// Settings that take effect on level load or restart are still queued
+	for (TMap<FName, FSettingValue>::TIterator It(PendingValues); It; ++It)
+	{
+		const FSettingsPicker& Setting = SettingsTableRowsInternal.FindChecked(It.Key());
+		const ESettingExecution Execution = Setting.PrimaryData.Execution;
+		if (Execution == ESettingExecution::OnLevelLoad
+			|| Execution == ESettingExecution::OnRestart)
+		{
+			QueueSettingValue(Setting, It.Value());
+			It.RemoveCurrent();
+		}
+	}
+
+	ExecuteSettingValues(PendingValues);
+}
+
+// Calls real setters of all queued values of specified execution
+void USettingsSubsystem::FlushQueuedSettings(ESettingExecution Execution)
+{
+	TMap<FName, FSettingValue> Values;
+	for (TMap<FName, FSettingValue>::TIterator It(QueuedValuesInternal); It; ++It)
+	{
+		const FSettingsPicker* Setting = SettingsTableRowsInternal.Find(It.Key());
+		if (Setting && Setting->PrimaryData.Execution == Execution)
+		{
+			Values.Emplace(It.Key(), MoveTemp(It.Value()));
+			It.RemoveCurrent();
+		}
+	}
+
+	ExecuteSettingValues(Values);
+}
+
+// Returns true if specified setting was changed, but takes effect only after restart
+bool USettingsSubsystem::IsSettingRequiresRestart(const FSettingTag& SettingTag) const
+{
+	return SettingTag.IsValid() && RestartRequiredSettingsInternal.Contains(SettingTag.GetTagName());
+}
+
+// Discards all staged values, real setters are not called
+void USettingsSubsystem::RevertPendingSettings()
+{
+	if (PendingValuesInternal.IsEmpty())
+	{
+		return;
+	}
+
+	TArray<FName> PendingSettings;
+	PendingValuesInternal.GenerateKeyArray(/*Out*/PendingSettings);
+	PendingValuesInternal.Reset();
+
+	for (const FName SettingIt : PendingSettings)
+	{
+		// Show real values again
+		FSettingsPicker& Setting = SettingsTableRowsInternal.FindChecked(SettingIt);
+		const FSettingTag& SettingTag = Setting.PrimaryData.Tag;
+		SetCachedValue(Setting, GetSettingTypedValue(SettingTag));
+		OnSettingChanged.Broadcast(SettingTag);
+	}
+}
+
+// Apply all current settings on device
+void USettingsSubsystem::ApplySettings()
+{
+	UGameUserSettings* GameUserSettings = GEngine->GetGameUserSettings();
+	if (!GameUserSettings)
+	{
+		return;
+	}
+
+	constexpr bool bCheckForCommandLineOverrides = false;
+	GameUserSettings->ApplySettings(bCheckForCommandLineOverrides);
+}
+
+// Takes current values of specified settings from their getters and sets them
+void USettingsSubsystem::UpdateSettings(const FGameplayTagContainer& SettingsToUpdate)
+{
+	if (SettingsToUpdate.IsEmpty()
+		|| !SettingsToUpdate.IsValidIndex(0))
+	{
+		return;
+	}
+
+	if (SettingsTableRowsInternal.IsEmpty())
+	{
+		UpdateSettingsTableRows();
+	}
+
+	TBitArray<> SettingsBits;
+	GetSettingsBits(SettingsToUpdate, /*Out*/SettingsBits);
+	UpdateSettingsByIds(SettingsBits);
+}
+
+// Takes current values of specified settings by their ids from their getters and sets them
+void USettingsSubsystem::UpdateSettingsByIds(const TBitArray<>& SettingsToUpdate)
+{
+	if (SettingsToUpdate.Find(true) == INDEX_NONE)
+	{
+		return;
+	}
+
+	// Dependencies were changed, so getters of all settings to update have to be called again, but only once per this update
+	InvalidateSettingsCacheByIds(SettingsToUpdate);
+	PrefetchGettersByIds(SettingsToUpdate);
+
+	// Values are taken from getters, so they are real and never staged or queued as user changes
+	TGuardValue<bool> ExecutingGuard(bIsExecutingInternal, true);
+
+	for (TConstSetBitIterator<> It(SettingsToUpdate); It && SettingRowsByIdInternal.IsValidIndex(It.GetIndex()); ++It)
+	{
+		const FSettingsPicker& Setting = *SettingRowsByIdInternal[It.GetIndex()];
+		const FSettingTag& SettingTag = Setting.PrimaryData.Tag;
+		if (!SettingTag.IsValid())
+		{
+			continue;
+		}
+
+		const FSettingsDataBase* ChosenData = Setting.GetChosenSettingsData();
+		if (!ChosenData)
+		{
+			continue;
+		}
+
+		if (ChosenData == &Setting.Checkbox)
+		{
+			const bool NewValue = GetCheckboxValue(SettingTag);
+			SetSettingCheckbox(SettingTag, NewValue);
+		}
+		else if (ChosenData == &Setting.Combobox)
+		{
+			if (Setting.Combobox.bAsyncGetMembers)
+			{
+				RequestComboboxMembers(SettingTag);
+			}
+
+			const int32 NewValue = GetComboboxIndex(SettingTag);
+			SetSettingComboboxIndex(SettingTag, NewValue);
+		}
+		else if (ChosenData == &Setting.Slider)
+		{
+			const double NewValue = GetSliderValue(SettingTag);
+			SetSettingSlider(SettingTag, NewValue);
+		}
+		else if (ChosenData == &Setting.TextLine)
+		{
+			FText NewValue = TEXT_NONE;
+			GetTextLineValue(SettingTag, /*Out*/NewValue);
+			SetSettingTextLine(SettingTag, NewValue);
+		}
+		else if (ChosenData == &Setting.UserInput)
+		{
+			const FName NewValue = GetUserInputValue(SettingTag);
+			SetSettingUserInput(SettingTag, NewValue);
+		}
+	}
+}
+
+// Splits specified settings into waves by their Settings To Update
+void USettingsSubsystem::GetSettingsApplyWaves(const TArray<FName>& Settings, TArray<TArray<FName>>& OutWaves) const
+{
+	OutWaves.Reset();
+
+	// The setting has to be applied after all settings that contain it in their Settings To Update
+	const int32 SettingsNum = Settings.Num();
+	TArray<int32> DependenciesNum;
+	DependenciesNum.SetNumZeroed(SettingsNum);
+	TArray<TArray<int32>> Dependents;
+	Dependents.SetNum(SettingsNum);
+	TArray<uint16> SettingIds;
+	SettingIds.Reserve(SettingsNum);
+	for (const FName SettingIt : Settings)
+	{
+		SettingIds.Emplace(SettingIdsInternal.FindChecked(SettingIt));
+	}
+
+	for (int32 Index = 0; Index < SettingsNum; ++Index)
+	{
+		const TBitArray<>& SettingsToUpdate = SettingsToUpdateBitsInternal[SettingIds[Index]];
+		if (SettingsToUpdate.Find(true) == INDEX_NONE)
+		{
+			continue;
+		}
+
+		for (int32 DependentIndex = 0; DependentIndex < SettingsNum; ++DependentIndex)
+		{
+			if (DependentIndex != Index
+				&& SettingsToUpdate[SettingIds[DependentIndex]])
+			{
+				Dependents[Index].Emplace(DependentIndex);
+				++DependenciesNum[DependentIndex];
+			}
+		}
+	}
+
+	TArray<int32> Wave;
+	for (int32 Index = 0; Index < SettingsNum; ++Index)
+	{
+		if (DependenciesNum[Index] == 0)
+		{
+			Wave.Emplace(Index);
+		}
+	}
+
+	int32 SortedNum = 0;
+	while (!Wave.IsEmpty())
+	{
+		TArray<FName>& OutWave = OutWaves.AddDefaulted_GetRef();
+		OutWave.Reserve(Wave.Num());
+		TArray<int32> NextWave;
+		for (const int32 IndexIt : Wave)
+		{
+			OutWave.Emplace(Settings[IndexIt]);
+			for (const int32 DependentIndexIt : Dependents[IndexIt])
+			{
+				if (--DependenciesNum[DependentIndexIt] == 0)
+				{
+					NextWave.Emplace(DependentIndexIt);
+				}
+			}
+		}
+		SortedNum += Wave.Num();
+		Wave = MoveTemp(NextWave);
+	}
+
+	if (SortedNum < SettingsNum)
+	{
+		// Settings in a cycle have no valid order, they are reported by the Settings Data Table Validator
+		TArray<FName>& OutWave = OutWaves.AddDefaulted_GetRef();
+		for (int32 Index = 0; Index < SettingsNum; ++Index)
+		{
+			if (DependenciesNum[Index] > 0)
+			{
+				OutWave.Emplace(Settings[Index]);
+			}
+		}
+	}
+}
+
+// Takes the value persisted in the config of the Static Context object from the getter and passes the saved one to the setter if they differ
+void USettingsSubsystem::ApplyPersistedValue(const FSettingsPicker& Setting, const FSettingValue* SavedValue, FSettingValue& OutDefaultValue)
+{
+	OutDefaultValue = ExecuteGetter(Setting);
+	if (!OutDefaultValue.IsValid()
+		|| !SavedValue
+		|| SavedValue->Type != OutDefaultValue.Type
+		|| *SavedValue == OutDefaultValue)
+	{
+		// Nothing is persisted over the config, so the setter is not called to avoid its side effects
+		return;
+	}
+
+	// The value of the binary save overrides the one of the config
+	ExecuteSetter(Setting, *SavedValue);
+}
+
+// Calls the bound getter of specified setting directly, without cache
+FSettingValue USettingsSubsystem::ExecuteGetter(const FSettingsPicker& Setting)
+{
+	const FSettingsPrimary& Primary = Setting.PrimaryData;
+	FSettingsProfilerScope ProfilerScope(Primary, ESettingsProfilerFunction::Getter, Primary.Getter);
+
+	const FSettingsDataBase* ChosenData = Setting.GetChosenSettingsData();
+	if (ChosenData == &Setting.Checkbox && Setting.Checkbox.OnGetterBool.IsBound())
+	{
+		return FSettingValue::MakeBool(Setting.Checkbox.OnGetterBool.Execute());
+	}
+
+	if (ChosenData == &Setting.Combobox && Setting.Combobox.OnGetterInt.IsBound())
+	{
+		return FSettingValue::MakeInt(Setting.Combobox.OnGetterInt.Execute());
+	}
+
+	if (ChosenData == &Setting.Slider && Setting.Slider.OnGetterFloat.IsBound())
+	{
+		return FSettingValue::MakeFloat(Setting.Slider.OnGetterFloat.Execute());
+	}
+
+	if (ChosenData == &Setting.UserInput && Setting.UserInput.OnGetterName.IsBound())
+	{
+		return FSettingValue::MakeName(Setting.UserInput.OnGetterName.Execute());
+	}
+
+	if (ChosenData == &Setting.TextLine && Setting.TextLine.OnGetterText.IsBound())
+	{
+		FText Value = TEXT_NONE;
+		Setting.TextLine.OnGetterText.Execute(/*Out*/Value);
+		return FSettingValue::MakeText(Value);
+	}
+
+	return FSettingValue::Empty;
+}
+
+// Calls the bound setter of specified setting directly, without propagation and broadcasting
+void USettingsSubsystem::ExecuteSetter(const FSettingsPicker& Setting, const FSettingValue& Value)
+{
+	const FSettingsPrimary& Primary = Setting.PrimaryData;
+	FSettingsProfilerScope ProfilerScope(Primary, ESettingsProfilerFunction::Setter, Primary.Setter);
+
+	const FSettingsDataBase* ChosenData = Setting.GetChosenSettingsData();
+	if (ChosenData == &Setting.Checkbox && Value.Type == ESettingValueType::Bool)
+	{
+		Setting.Checkbox.OnSetterBool.ExecuteIfBound(Value.BoolValue);
+	}
+	else if (ChosenData == &Setting.Combobox && Value.Type == ESettingValueType::Int)
+	{
+		Setting.Combobox.OnSetterInt.ExecuteIfBound(Value.IntValue);
+	}
+	else if (ChosenData == &Setting.Slider && Value.Type == ESettingValueType::Float)
+	{
+		Setting.Slider.OnSetterFloat.ExecuteIfBound(Value.FloatValue);
+	}
+	else if (ChosenData == &Setting.UserInput && Value.Type == ESettingValueType::Name)
+	{
+		Setting.UserInput.OnSetterName.ExecuteIfBound(Value.NameValue);
+	}
+	else if (ChosenData == &Setting.TextLine && Value.Type == ESettingValueType::Text)
+	{
+		Setting.TextLine.OnSetterText.ExecuteIfBound(Value.TextValue);
+	}
+}
+
+// Marks cached getter results of specified settings as outdated
+void USettingsSubsystem::InvalidateSettingsCache(const FGameplayTagContainer& SettingsToInvalidate)
+{
+	if (SettingsToInvalidate.IsEmpty())
+	{
+		return;
+	}
+
+	TBitArray<> SettingsBits;
+	GetSettingsBits(SettingsToInvalidate, /*Out*/SettingsBits);
+	InvalidateSettingsCacheByIds(SettingsBits);
+}
+
+// Marks cached getter results of specified settings by their ids as outdated
+void USettingsSubsystem::InvalidateSettingsCacheByIds(const TBitArray<>& SettingsToInvalidate)
+{
+	if (SettingsToInvalidate.Find(true) == INDEX_NONE)
+	{
+		return;
+	}
+
+	const uint32 NewEpoch = ++SettingsEpochInternal;
+	for (TConstSetBitIterator<> It(SettingsToInvalidate); It && GetterCachesByIdInternal.IsValidIndex(It.GetIndex()); ++It)
+	{
+		GetterCachesByIdInternal[It.GetIndex()]->InvalidatedEpoch = NewEpoch;
+	}
+}
+
+// Takes current values only of settings which Static Context object reports a new version since previous refresh
+void USettingsSubsystem::RefreshStaleSettings()
+{
+	FGameplayTagContainer StaleSettings;
+	FGameplayTagContainer UnversionedSettings;
+	TMap<const UObject*, int32> SourceVersions;
+	for (const TTuple<FName, FSettingsPicker>& RowIt : SettingsTableRowsInternal)
+	{
+		const FSettingsPrimary& Primary = RowIt.Value.PrimaryData;
+		const UObject* StaticContextObject = Primary.StaticContextObject.Get();
+		FSettingsGetterCache* GetterCache = GetterCacheInternal.Find(RowIt.Key);
+		if (!StaticContextObject
+			|| !GetterCache)
+		{
+			// Is not bound yet, so its values will be taken on binding
+			continue;
+		}
+
+		// Query each object once, since it is shared by many settings
+		const int32* SourceVersionPtr = SourceVersions.Find(StaticContextObject);
+		const int32 SourceVersion = SourceVersionPtr ? *SourceVersionPtr : SourceVersions.Emplace(StaticContextObject, ISettingsVersionSource::GetVersion(StaticContextObject));
+		if (SourceVersion == INDEX_NONE)
+		{
+			UnversionedSettings.AddTag(Primary.Tag);
+		}
+		else if (SourceVersion != GetterCache->SourceVersion)
+		{
+			GetterCache->SourceVersion = SourceVersion;
+			StaleSettings.AddTag(Primary.Tag);
+		}
+	}
+
+	if (!UnversionedSettings.IsEmpty())
+	{
+		// It's unknown whether unversioned settings were changed, so take their values lazily on next request
+		InvalidateSettingsCache(UnversionedSettings);
+		PrefetchGetters(UnversionedSettings);
+	}
+
+	UpdateSettings(StaleSettings);
+}
+
+// Remembers current settings versions of Static Context objects of specified settings
+void USettingsSubsystem::RecordSourceVersions(const FGameplayTagContainer& Settings)
+{
+	if (Settings.IsEmpty())
+	{
+		return;
+	}
+
+	for (const TTuple<FName, FSettingsPicker>& RowIt : SettingsTableRowsInternal)
+	{
+		const FSettingsPrimary& Primary = RowIt.Value.PrimaryData;
+		FSettingsGetterCache* GetterCache = GetterCacheInternal.Find(RowIt.Key);
+		if (GetterCache
+			&& Primary.Tag.MatchesAny(Settings))
+		{
+			GetterCache->SourceVersion = ISettingsVersionSource::GetVersion(Primary.StaticContextObject.Get());
+		}
+	}
+}
+
+// Calls outdated getters of specified thread-safe settings in parallel and caches their results
+void USettingsSubsystem::PrefetchGetters(const FGameplayTagContainer& SettingsToPrefetch)
+{
+	TBitArray<> SettingsBits;
+	if (SettingsToPrefetch.IsEmpty())
+	{
+		SettingsBits.Init(true, SettingRowsByIdInternal.Num());
+	}
+	else
+	{
+		GetSettingsBits(SettingsToPrefetch, /*Out*/SettingsBits);
+	}
+
+	PrefetchGettersByIds(SettingsBits);
+}
+
+// Calls outdated getters of specified thread-safe settings by their ids in parallel and caches their results
+void USettingsSubsystem::PrefetchGettersByIds(const TBitArray<>& SettingsToPrefetch)
+{
+	TArray<const FSettingsPicker*> Settings;
+	TArray<FSettingsGetterCache*> GetterCaches;
+	for (TConstSetBitIterator<> It(SettingsToPrefetch); It && SettingRowsByIdInternal.IsValidIndex(It.GetIndex()); ++It)
+	{
+		const FSettingsPicker& Setting = *SettingRowsByIdInternal[It.GetIndex()];
+		const FSettingsPrimary& Primary = Setting.PrimaryData;
+		if (!IsThreadSafeGetter(Primary)
+			|| !Primary.StaticContextObject.IsValid())
+		{
+			continue;
+		}
+
+		FSettingsGetterCache* GetterCache = GetterCachesByIdInternal[It.GetIndex()];
+		if (GetterCache->IsStale(GetterCache->GetterEpoch, AllSettingsInvalidatedEpochInternal))
+		{
+			Settings.Emplace(&Setting);
+			GetterCaches.Emplace(GetterCache);
+		}
+	}
+
+	static constexpr int32 MinParallelGettersNum = 2;
+	if (Settings.Num() < MinParallelGettersNum)
+	{
+		// Is not worth to start workers, the getter is called on request
+		return;
+	}
+
+	// Getters might invalidate settings by themselves, so stamp results by the epoch before the calls
+	const uint32 CurrentEpoch = SettingsEpochInternal;
+	TArray<FSettingValue> Values;
+	Values.SetNum(Settings.Num());
+	ParallelFor(Settings.Num(), [&Settings, &Values](int32 Index)
+	{
+		Values[Index] = ExecuteGetter(*Settings[Index]);
+	});
+
+	// Results are written serially, so the cache is never changed by workers
+	for (int32 Index = 0; Index < Values.Num(); ++Index)
+	{
+		FSettingsGetterCache& GetterCache = *GetterCaches[Index];
+		const FSettingValue& Value = Values[Index];
+		switch (Value.Type)
+		{
+		case ESettingValueType::Bool:
+			GetterCache.bIsSet = Value.BoolValue;
+			break;
+		case ESettingValueType::Int:
+			GetterCache.ChosenMemberIndex = Value.IntValue;
+			break;
+		case ESettingValueType::Float:
+			GetterCache.ChosenValue = Value.FloatValue;
+			break;
+		case ESettingValueType::Name:
+			GetterCache.UserInput = Value.NameValue;
+			break;
+		case ESettingValueType::Text:
+			GetterCache.Text = Value.TextValue;
+			break;
+		default:
+			continue;
+		}
+		GetterCache.GetterEpoch = CurrentEpoch;
+	}
+}
+
+// Measures the time of calling all bound thread-safe getters split between increasing amount of workers
+void USettingsSubsystem::BenchmarkGetters(FOutputDevice& Ar, int32 RowsMultiplier, int32 Iterations)
+{
+	TArray<const FSettingsPicker*> Settings;
+	for (const TTuple<FName, FSettingsPicker>& RowIt : SettingsTableRowsInternal)
+	{
+		const FSettingsPrimary& Primary = RowIt.Value.PrimaryData;
+		if (IsThreadSafeGetter(Primary)
+			&& Primary.StaticContextObject.IsValid())
+		{
+			Settings.Emplace(&RowIt.Value);
+		}
+	}
+
+	if (Settings.IsEmpty())
+	{
+		Ar.Log(TEXT("There are no bound settings with thread-safe getters to benchmark, mark rows by 'Is Thread Safe Getter'"));
+		return;
+	}
+
+	// Emulate large tables by evaluating the same rows several times
+	const TArray<const FSettingsPicker*> ThreadSafeSettings = Settings;
+	Settings.Reserve(ThreadSafeSettings.Num() * RowsMultiplier);
+	for (int32 Index = 1; Index < RowsMultiplier; ++Index)
+	{
+		Settings.Append(ThreadSafeSettings);
+	}
+
+	TArray<FSettingValue> Values;
+	Values.SetNum(Settings.Num());
+
+	// The game thread also takes a chunk, so it is counted as a worker
+	const int32 MaxWorkersNum = FTaskGraphInterface::Get().GetNumWorkerThreads() + 1;
+	TArray<int32> WorkersNums;
+	for (int32 WorkersNum = 1; WorkersNum < MaxWorkersNum; WorkersNum *= 2)
+	{
+		WorkersNums.Emplace(WorkersNum);
+	}
+	WorkersNums.Emplace(MaxWorkersNum);
+
+	Ar.Logf(TEXT("Settings getters benchmark: %d rows (%d thread-safe x%d), %d iterations, %d workers"),
+	        Settings.Num(), ThreadSafeSettings.Num(), RowsMultiplier, Iterations, MaxWorkersNum);
+
+	double SerialSeconds = 0.0;
+	for (const int32 WorkersNum : WorkersNums)
+	{
+		const int32 ChunkSize = FMath::DivideAndRoundUp(Settings.Num(), WorkersNum);
+		const double StartSeconds = FPlatformTime::Seconds();
+		for (int32 Iteration = 0; Iteration < Iterations; ++Iteration)
+		{
+			ParallelFor(WorkersNum, [&Settings, &Values, ChunkSize](int32 ChunkIndex)
+			{
+				const int32 EndIndex = FMath::Min((ChunkIndex + 1) * ChunkSize, Settings.Num());
+				for (int32 Index = ChunkIndex * ChunkSize; Index < EndIndex; ++Index)
+				{
+					Values[Index] = ExecuteGetter(*Settings[Index]);
+				}
+			}, WorkersNum == 1 ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None);
+		}
+
+		const double Seconds = (FPlatformTime::Seconds() - StartSeconds) / Iterations;
+		if (WorkersNum == 1)
+		{
+			SerialSeconds = Seconds;
+		}
+
+		Ar.Logf(TEXT("  %3d workers: %9.3f ms, speedup x%.2f"), WorkersNum, Seconds * 1000.0, Seconds > 0.0 ? SerialSeconds / Seconds : 0.0);
+	}
+}
+
+// Marks cached getter results of all settings as outdated
+void USettingsSubsystem::InvalidateAllSettingsCache()
+{
+	AllSettingsInvalidatedEpochInternal = ++SettingsEpochInternal;
+}
+
+// Returns the name of found tag by specified function
+const FSettingTag& USettingsSubsystem::GetTagByFunction(const FSettingFunctionPicker& FunctionPicker) const
+{
+	// Only rows with the same function name are compared, since the function class might be a child one
+	TArray<FName, TInlineAllocator<4>> FoundTags;
+	TagsByFunctionInternal.MultiFind(FunctionPicker.FunctionName, /*Out*/FoundTags, /*bMaintainOrder*/true);
+	for (const FName TagIt : FoundTags)
+	{
+		const FSettingsPrimary& PrimaryData = SettingsTableRowsInternal.FindChecked(TagIt).PrimaryData;
+		if (PrimaryData.Getter == FunctionPicker
+			|| PrimaryData.Setter == FunctionPicker)
+		{
+			return PrimaryData.Tag;
+		}
+	}
+
+	return FSettingTag::EmptySettingTag;
+}
+
+// Calls specified callback each time specified setting commits new value
+FDelegateHandle USettingsSubsystem::SubscribeToSetting(const FSettingTag& SettingTag, FOnSettingValueChanged&& Callback, bool bMatchChildren)
+{
+	if (!SettingTag.IsValid()
+		|| !Callback.IsBound())
+	{
+		return FDelegateHandle();
+	}
+
+	FSettingSubscription Subscription;
+	Subscription.Handle = FDelegateHandle(FDelegateHandle::GenerateNewHandle);
+	Subscription.bMatchChildren = bMatchChildren;
+	Subscription.Callback = MoveTemp(Callback);
+	return SubscriptionsInternal.Add(SettingTag.GetTagName(), MoveTemp(Subscription)).Handle;
+}
+
+// Removes the subscription by its handle
+void USettingsSubsystem::UnsubscribeFromSetting(FDelegateHandle& InOutHandle)
+{
+	if (!InOutHandle.IsValid())
+	{
+		return;
+	}
+
+	for (TMultiMap<FName, FSettingSubscription>::TIterator It(SubscriptionsInternal); It; ++It)
+	{
+		if (It.Value().Handle == InOutHandle)
+		{
+			It.RemoveCurrent();
+			break;
+		}
+	}
+
+	InOutHandle.Reset();
+}
+
+// Calls specified event each time specified setting commits new value
+void USettingsSubsystem::K2_SubscribeToSetting(const FSettingTag& SettingTag, FOnSettingValueChangedDynamic Callback, bool bMatchChildren)
+{
+	if (!SettingTag.IsValid()
+		|| !Callback.IsBound())
+	{
+		return;
+	}
+
+	FSettingSubscription Subscription;
+	Subscription.Handle = FDelegateHandle(FDelegateHandle::GenerateNewHandle);
+	Subscription.bMatchChildren = bMatchChildren;
+	Subscription.DynamicCallback = MoveTemp(Callback);
+	SubscriptionsInternal.Add(SettingTag.GetTagName(), MoveTemp(Subscription));
+}
+
+// Removes the subscription of specified event from specified setting
+void USettingsSubsystem::K2_UnsubscribeFromSetting(const FSettingTag& SettingTag, FOnSettingValueChangedDynamic Callback)
+{
+	for (TMultiMap<FName, FSettingSubscription>::TKeyIterator It(SubscriptionsInternal, SettingTag.GetTagName()); It; ++It)
+	{
+		if (It.Value().DynamicCallback == Callback)
+		{
+			It.RemoveCurrent();
+		}
+	}
+}
+
+// Is called when the setting committed new value: updates the snapshot for worker threads and calls subscribers
+void USettingsSubsystem::OnSettingValueCommitted(const FSettingTag& SettingTag, const FSettingValue& Value)
+{
+	SnapshotValuesInternal.Emplace(SettingTag.GetTagName(), Value);
+	bIsSnapshotDirtyInternal = true;
+
+	if (SubscriptionsInternal.IsEmpty())
+	{
+		return;
+	}
+
+	// Callbacks are copied, since they might subscribe or unsubscribe while being called
+	TArray<FSettingSubscription, TInlineAllocator<4>> Subscriptions;
+	bool bIsParent = false;
+	for (FGameplayTag TagIt = SettingTag; TagIt.IsValid(); TagIt = TagIt.RequestDirectParent())
+	{
+		for (TMultiMap<FName, FSettingSubscription>::TConstKeyIterator It(SubscriptionsInternal, TagIt.GetTagName()); It; ++It)
+		{
+			if (!bIsParent || It.Value().bMatchChildren)
+			{
+				Subscriptions.Emplace(It.Value());
+			}
+		}
+		bIsParent = true;
+	}
+
+	for (const FSettingSubscription& SubscriptionIt : Subscriptions)
+	{
+		SubscriptionIt.Callback.ExecuteIfBound(SettingTag, Value);
+		SubscriptionIt.DynamicCallback.ExecuteIfBound(SettingTag, Value);
+	}
+}
+
+// Publishes values of all bound settings for worker threads right away
+void USettingsSubsystem::PublishSnapshot()
+{
+	SnapshotSourceInternal->Publish(SnapshotValuesInternal);
+	bIsSnapshotDirtyInternal = false;
+}
+
+// Takes current values of specified settings into the snapshot for worker threads
+void USettingsSubsystem::CaptureSnapshotValues(const FGameplayTagContainer& Settings)
+{
+	if (Settings.IsEmpty())
+	{
+		return;
+	}
+
+	for (const FGameplayTag& TagIt : Settings)
+	{
+		const FSettingTag& SettingTag = SettingsTableRowsInternal.FindChecked(TagIt.GetTagName()).PrimaryData.Tag;
+		const FSettingValue Value = GetSettingTypedValue(SettingTag);
+		if (Value.IsValid())
+		{
+			SnapshotValuesInternal.Emplace(SettingTag.GetTagName(), Value);
+		}
+	}
+	bIsSnapshotDirtyInternal = true;
+}
+
+// Publishes the snapshot if any value was committed during this frame
+bool USettingsSubsystem::TickSnapshot(float DeltaTime)
+{
+	if (bIsSnapshotDirtyInternal)
+	{
+		PublishSnapshot();
+	}
+	return true;
+}
+
+// Takes current values of settings bound to specified object, is called by the game after it changed them directly
+void USettingsSubsystem::NotifySettingSourceChanged(const UObject* StaticContextObject, FName FunctionName)
+{
+	if (!StaticContextObject)
+	{
+		return;
+	}
+
+	TArray<FName, TInlineAllocator<8>> FoundTags;
+	TagsByContextInternal.MultiFind(StaticContextObject, /*Out*/FoundTags);
+
+	FGameplayTagContainer SettingsToUpdate;
+	for (const FName TagIt : FoundTags)
+	{
+		const FSettingsPicker& Setting = SettingsTableRowsInternal.FindChecked(TagIt);
+		const FSettingsPrimary& Primary = Setting.PrimaryData;
+		if (Primary.StaticContextObject.Get() != StaticContextObject)
+		{
+			// Was rebound to another object
+			continue;
+		}
+
+		const bool bIsChangedFunction = FunctionName.IsNone()
+			|| Primary.Getter.FunctionName == FunctionName
+			|| Primary.Setter.FunctionName == FunctionName
+			|| Setting.Combobox.GetMembers.FunctionName == FunctionName
+			|| Setting.Combobox.SetMembers.FunctionName == FunctionName;
+		if (bIsChangedFunction)
+		{
+			SettingsToUpdate.AddTag(Primary.Tag);
+		}
+	}
+
+	// Dependent settings are updated by setters of changed settings
+	UpdateSettings(SettingsToUpdate);
+
+	// Members of comboboxes might be changed as well, async ones are already requested by the update
+	for (const FGameplayTag& TagIt : SettingsToUpdate)
+	{
+		FSettingsPicker& Setting = SettingsTableRowsInternal.FindChecked(TagIt.GetTagName());
+		FSettingsCombobox& Data = Setting.Combobox;
+		if (Setting.GetChosenSettingsData() == &Data
+			&& Data.OnGetMembers.IsBound()
+			&& !Data.bAsyncGetMembers)
+		{
+			const FSettingTag& SettingTag = Setting.PrimaryData.Tag;
+			GetComboboxMembers(SettingTag, /*Out*/Data.Members);
+			OnComboboxMembersChanged.Broadcast(SettingTag);
+		}
+	}
+}
+
+// Returns tags of all settings bound to specified object
+void USettingsSubsystem::GetSettingsByContext(const UObject* StaticContextObject, FGameplayTagContainer& OutSettings) const
+{
+	OutSettings.Reset();
+	if (!StaticContextObject)
+	{
+		return;
+	}
+
+	TArray<FName, TInlineAllocator<8>> FoundTags;
+	TagsByContextInternal.MultiFind(StaticContextObject, /*Out*/FoundTags);
+	for (const FName TagIt : FoundTags)
+	{
+		const FSettingsPrimary& Primary = SettingsTableRowsInternal.FindChecked(TagIt).PrimaryData;
+		if (Primary.StaticContextObject.Get() == StaticContextObject)
+		{
+			OutSettings.AddTag(Primary.Tag);
+		}
+	}
+}
+
+// Calls Get Members of specified async combobox in background, its members are updated once the result is received
+void USettingsSubsystem::RequestComboboxMembers(const FSettingTag& ComboboxTag)
+{
+	const FSettingsPicker& FoundRow = GetSettingRow(ComboboxTag);
+	const USettingFunctionTemplate::FOnGetMembers& Getter = FoundRow.Combobox.OnGetMembers;
+	if (!Getter.IsBound()
+		|| IsSettingLoading(ComboboxTag))
+	{
+		return;
+	}
+
+	const FName TagName = ComboboxTag.GetTagName();
+	if (FoundRow.PrimaryData.bIsThreadSafe)
+	{
+		MembersTasksInternal.Emplace(TagName, UE::Tasks::Launch(UE_SOURCE_LOCATION, [Getter]
+		{
+			TArray<FText> Members;
+			Getter.ExecuteIfBound(Members);
+			return Members;
+		}));
+	}
+	else
+	{
+		DeferredMembersInternal.Emplace(TagName);
+	}
+
+	if (!AsyncGettersTickerInternal.IsValid())
+	{
+		AsyncGettersTickerInternal = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateUObject(this, &ThisClass::TickAsyncGetters));
+	}
+
+	OnSettingLoadingChanged.Broadcast(ComboboxTag, true);
+}
+
+// Returns true if the async setter of specified setting is not completed yet
+bool USettingsSubsystem::IsSettingInFlight(const FSettingTag& SettingTag) const
+{
+	return SetterTasksInternal.Contains(SettingTag.GetTagName());
+}
+
+// Waits for all async setters and completes them
+void USettingsSubsystem::FlushAsyncSetters()
+{
+	// Superseded setters are launched again on each tick, so wait until all of them are completed
+	while (!SetterTasksInternal.IsEmpty())
+	{
+		for (TTuple<FName, UE::Tasks::FTask>& TaskIt : SetterTasksInternal)
+		{
+			TaskIt.Value.Wait();
+		}
+
+		TickAsyncSetters(0.f);
+	}
+}
+
+// Returns true if the async getter of specified setting is not finished yet
+bool USettingsSubsystem::IsSettingLoading(const FSettingTag& SettingTag) const
+{
+	const FName TagName = SettingTag.GetTagName();
+	return MembersTasksInternal.Contains(TagName)
+		|| DeferredMembersInternal.Contains(TagName);
+}
+
+// Applies results of finished async getters in one batch on the game thread
+bool USettingsSubsystem::TickAsyncGetters(float DeltaTime)
+{
+	TMap<FName, TArray<FText>> Results;
+	for (TMap<FName, UE::Tasks::TTask<TArray<FText>>>::TIterator It(MembersTasksInternal); It; ++It)
+	{
+		if (It.Value().IsCompleted())
+		{
+			Results.Emplace(It.Key(), MoveTemp(It.Value().GetResult()));
+			It.RemoveCurrent();
+		}
+	}
+
+	// Getters might request members of other comboboxes, so take the set out before calling them
+	const TSet<FName> DeferredMembers = MoveTemp(DeferredMembersInternal);
+	DeferredMembersInternal.Reset();
+	for (const FName SettingIt : DeferredMembers)
+	{
+		const FSettingsPicker& Setting = SettingsTableRowsInternal.FindChecked(SettingIt);
+		const FSettingsCombobox& Data = Setting.Combobox;
+		FSettingsProfilerScope ProfilerScope(Setting.PrimaryData, ESettingsProfilerFunction::GetMembers, Data.GetMembers);
+		Data.OnGetMembers.ExecuteIfBound(/*Out*/Results.Emplace(SettingIt));
+	}
+
+	const uint32 CurrentEpoch = SettingsEpochInternal;
+	for (TTuple<FName, TArray<FText>>& ResultIt : Results)
+	{
+		FSettingsPicker& Setting = SettingsTableRowsInternal.FindChecked(ResultIt.Key);
+		if (FSettingsGetterCache* GetterCache = FindGetterCache(Setting.PrimaryData.Tag))
+		{
+			GetterCache->Members = ResultIt.Value;
+			GetterCache->MembersEpoch = CurrentEpoch;
+		}
+		Setting.Combobox.Members = MoveTemp(ResultIt.Value);
+	}
+
+	// Broadcast only after all results are applied, so UI is updated once per batch
+	for (const TTuple<FName, TArray<FText>>& ResultIt : Results)
+	{
+		const FSettingTag& SettingTag = SettingsTableRowsInternal.FindChecked(ResultIt.Key).PrimaryData.Tag;
+		OnComboboxMembersChanged.Broadcast(SettingTag);
+		OnSettingLoadingChanged.Broadcast(SettingTag, false);
+	}
+
+	const bool bHasAsyncGetters = !MembersTasksInternal.IsEmpty() || !DeferredMembersInternal.IsEmpty();
+	if (!bHasAsyncGetters)
+	{
+		AsyncGettersTickerInternal.Reset();
+	}
+	return bHasAsyncGetters;
+}
+
+// Waits for all running async getters and discards their results
+void USettingsSubsystem::CancelAsyncGetters()
+{
+	FTSTicker::GetCoreTicker().RemoveTicker(AsyncGettersTickerInternal);
+	AsyncGettersTickerInternal.Reset();
+
+	// Getters are bound to Static Context objects, so they have to finish before rows are reset
+	for (TTuple<FName, UE::Tasks::TTask<TArray<FText>>>& TaskIt : MembersTasksInternal)
+	{
+		TaskIt.Value.Wait();
+	}
+
+	MembersTasksInternal.Empty();
+	DeferredMembersInternal.Empty();
+}
+
+// Set value to the option by tag
+void USettingsSubsystem::SetSettingValue(FName TagName, const FString& Value)
+{
+	const FSettingsPicker& FoundRow = FindSettingRow(TagName);
+	if (!FoundRow.IsValid())
+	{
+		return;
+	}
+
+	const FSettingsDataBase* ChosenData = FoundRow.GetChosenSettingsData();
+	if (!ChosenData)
+	{
+		return;
+	}
+
+	const FSettingTag& Tag = FoundRow.PrimaryData.Tag;
+	if (!Tag.IsValid())
+	{
+		return;
+	}
+
+	if (ChosenData == &FoundRow.Button)
+	{
+		SetSettingButtonPressed(Tag);
+	}
+	else if (ChosenData == &FoundRow.Checkbox)
+	{
+		const bool NewValue = Value.ToBool();
+		SetSettingCheckbox(Tag, NewValue);
+	}
+	else if (ChosenData == &FoundRow.Combobox)
+	{
+		if (Value.IsNumeric())
+		{
+			const int32 NewValue = FCString::Atoi(*Value);
+			SetSettingComboboxIndex(Tag, NewValue);
+		}
+		else
+		{
+			static const FString Delimiter = TEXT(",");
+			TArray<FString> SeparatedStrings;
+			Value.ParseIntoArray(SeparatedStrings, *Delimiter);
+
+			TArray<FText> NewMembers;
+			NewMembers.Reserve(SeparatedStrings.Num());
+			for (FString& StringIt : SeparatedStrings)
+			{
+				NewMembers.Emplace(FText::FromString(MoveTemp(StringIt)));
+			}
+			SetSettingComboboxMembers(Tag, NewMembers);
+		}
+	}
+	else if (ChosenData == &FoundRow.Slider)
+	{
+		const double NewValue = FCString::Atod(*Value);
+		SetSettingSlider(Tag, NewValue);
+	}
+	else if (ChosenData == &FoundRow.TextLine)
+	{
+		const FText NewValue = FText::FromString(Value);
+		SetSettingTextLine(Tag, NewValue);
+	}
+	else if (ChosenData == &FoundRow.UserInput)
+	{
+		const FName NewValue = *Value;
+		SetSettingUserInput(Tag, NewValue);
+	}
+}
+
+// Set the typed value to the setting of any type
+void USettingsSubsystem::SetSettingTypedValue(const FSettingTag& SettingTag, const FSettingValue& Value)
+{
+	switch (Value.Type)
+	{
+	case ESettingValueType::Bool:
+		SetSettingCheckbox(SettingTag, Value.BoolValue);
+		break;
+	case ESettingValueType::Int:
+		SetSettingComboboxIndex(SettingTag, Value.IntValue);
+		break;
+	case ESettingValueType::Float:
+		SetSettingSlider(SettingTag, Value.FloatValue);
+		break;
+	case ESettingValueType::Name:
+		SetSettingUserInput(SettingTag, Value.NameValue);
+		break;
+	case ESettingValueType::Text:
+		SetSettingTextLine(SettingTag, Value.TextValue);
+		break;
+	case ESettingValueType::Members:
+		SetSettingComboboxMembers(SettingTag, Value.MembersValue);
+		SetSettingComboboxIndex(SettingTag, Value.IntValue);
+		break;
+	default:
+		break;
+	}
+}
+
+// Sets typed values to specified settings in one call without string parsing
+void USettingsSubsystem::SetSettingValues(const TArray<FSettingTag>& SettingTags, const TArray<FSettingValue>& Values)
+{
+	if (!ensureMsgf(SettingTags.Num() == Values.Num(), TEXT("ASSERT: 'SettingTags' and 'Values' have different amount: %d != %d"), SettingTags.Num(), Values.Num()))
+	{
+		return;
+	}
+
+	TMap<FName, FSettingValue> ValuesToExecute;
+	for (int32 Index = 0; Index < SettingTags.Num(); ++Index)
+	{
+		const FSettingTag& SettingTag = SettingTags[Index];
+		FSettingsPicker* SettingPtr = SettingTag.IsValid() ? SettingsTableRowsInternal.Find(SettingTag.GetTagName()) : nullptr;
+		if (!SettingPtr)
+		{
+			continue;
+		}
+
+		FSettingValue Value = Values[Index];
+		if (Value.Type == ESettingValueType::Members)
+		{
+			// Members are set before the index, so the index is chosen among new members
+			SetSettingComboboxMembers(SettingTag, Value.MembersValue);
+			if (Value.IntValue == INDEX_NONE)
+			{
+				continue;
+			}
+			Value = FSettingValue::MakeInt(Value.IntValue);
+		}
+		else if (Value.Type == ESettingValueType::Float)
+		{
+			Value.FloatValue = FMath::Clamp(Value.FloatValue, 0.0, 1.0);
+		}
+		else if (Value.Type == ESettingValueType::Name)
+		{
+			const int32 MaxCharactersNumber = SettingPtr->UserInput.MaxCharactersNumber;
+			if (Value.NameValue.IsNone())
+			{
+				continue;
+			}
+
+			if (MaxCharactersNumber > 0)
+			{
+				Value.NameValue = *Value.NameValue.ToString().Left(MaxCharactersNumber);
+			}
+		}
+
+		// The type has to match the setting archetype, unchanged values are skipped as typed setters do
+		const FSettingValue CachedValue = GetCachedValue(*SettingPtr);
+		if (!Value.IsValid()
+			|| CachedValue.Type != Value.Type
+			|| CachedValue == Value)
+		{
+			continue;
+		}
+
+		SetCachedValue(*SettingPtr, Value);
+		if (!StageSettingValue(*SettingPtr, Value))
+		{
+			ValuesToExecute.Emplace(SettingTag.GetTagName(), Value);
+		}
+	}
+
+	// Call setters and update dependent settings once for all values
+	ExecuteSettingValues(ValuesToExecute, /*bIsApplying*/false);
+}
+
+// Press button
+void USettingsSubsystem::SetSettingButtonPressed(const FSettingTag& ButtonTag)
+{
+	if (!ButtonTag.IsValid())
+	{
+		return;
+	}
+
+	const FSettingsPicker* SettingsRowPtr = SettingsTableRowsInternal.Find(ButtonTag.GetTagName());
+	if (!SettingsRowPtr)
+	{
+		return;
+	}
+
+	if (SettingsRowPtr->Button.OnButtonPressed.IsBound())
+	{
+		FSettingsProfilerScope ProfilerScope(SettingsRowPtr->PrimaryData, ESettingsProfilerFunction::Setter, SettingsRowPtr->PrimaryData.Setter);
+		SettingsRowPtr->Button.OnButtonPressed.Execute();
+	}
+	InvalidateSettingCache(ButtonTag);
+
+	UpdateSettingsByIds(GetSettingsToUpdateBits(SettingsRowPtr->PrimaryData.Tag));
+
+	OnSettingChanged.Broadcast(ButtonTag);
+}
+
+// Toggle checkbox
+void USettingsSubsystem::SetSettingCheckbox(const FSettingTag& CheckboxTag, bool InValue)
+{
+	if (!CheckboxTag.IsValid())
+	{
+		return;
+	}
+
+	FSettingsPicker* SettingsRowPtr = SettingsTableRowsInternal.Find(CheckboxTag.GetTagName());
+	if (!SettingsRowPtr)
+	{
+		return;
+	}
+
+	bool& bIsSetRef = SettingsRowPtr->Checkbox.bIsSet;
+	if (bIsSetRef == InValue)
+	{
+		return;
+	}
+
+	bIsSetRef = InValue;
+	CommitSettingValue(*SettingsRowPtr, FSettingValue::MakeBool(InValue));
+}
+
+// Set chosen member index for a combobox
+void USettingsSubsystem::SetSettingComboboxIndex(const FSettingTag& ComboboxTag, int32 InValue)
+{
+	if (!ComboboxTag.IsValid())
+	{
+		return;
+	}
+
+	if (InValue == INDEX_NONE)
+	{
+		return;
+	}
+
+	FSettingsPicker* SettingsRowPtr = SettingsTableRowsInternal.Find(ComboboxTag.GetTagName());
+	if (!SettingsRowPtr)
+	{
+		return;
+	}
+
+	FSettingsPicker& SettingsRowRef = *SettingsRowPtr;
+	int32& ChosenMemberIndexRef = SettingsRowRef.Combobox.ChosenMemberIndex;
+	if (ChosenMemberIndexRef == InValue)
+	{
+		return;
+	}
+
+	ChosenMemberIndexRef = InValue;
+	CommitSettingValue(SettingsRowRef, FSettingValue::MakeInt(InValue));
+}
+
+// Set new members for a combobox
+void USettingsSubsystem::SetSettingComboboxMembers(const FSettingTag& ComboboxTag, const TArray<FText>& InValue)
+{
+	if (!ComboboxTag.IsValid())
+	{
+		return;
+	}
+
+	FSettingsPicker* SettingsRowPtr = SettingsTableRowsInternal.Find(ComboboxTag.GetTagName());
+	if (!SettingsRowPtr)
+	{
+		return;
+	}
+
+	SettingsRowPtr->Combobox.Members = InValue;
+	if (SettingsRowPtr->Combobox.OnSetMembers.IsBound())
+	{
+		FSettingsProfilerScope ProfilerScope(SettingsRowPtr->PrimaryData, ESettingsProfilerFunction::SetMembers, SettingsRowPtr->Combobox.SetMembers);
+		SettingsRowPtr->Combobox.OnSetMembers.Execute(InValue);
+	}
+	InvalidateSettingCache(ComboboxTag);
+
+	OnComboboxMembersChanged.Broadcast(ComboboxTag);
+}
+
+// Set current value for a slider
+void USettingsSubsystem::SetSettingSlider(const FSettingTag& SliderTag, double InValue)
+{
+	if (!SliderTag.IsValid())
+	{
+		return;
+	}
+
+	FSettingsPicker* SettingsRowPtr = SettingsTableRowsInternal.Find(SliderTag.GetTagName());
+	if (!SettingsRowPtr)
+	{
+		return;
+	}
+
+	static constexpr double MinValue = 0.0;
+	static constexpr float MaxValue = 1.0;
+	const double NewValue = FMath::Clamp(InValue, MinValue, MaxValue);
+	double& ChosenValueRef = SettingsRowPtr->Slider.ChosenValue;
+	if (ChosenValueRef == NewValue)
+	{
+		return;
+	}
+
+	ChosenValueRef = NewValue;
+	CommitSettingValue(*SettingsRowPtr, FSettingValue::MakeFloat(NewValue));
+}
+
+// Set new text
+void USettingsSubsystem::SetSettingTextLine(const FSettingTag& TextLineTag, const FText& InValue)
+{
+	if (!TextLineTag.IsValid())
+	{
+		return;
+	}
+
+	FSettingsPicker* SettingsRowPtr = SettingsTableRowsInternal.Find(TextLineTag.GetTagName());
+	if (!SettingsRowPtr)
+	{
+		return;
+	}
+
+	FSettingsPrimary& PrimaryRef = SettingsRowPtr->PrimaryData;
+	FText& CaptionRef = PrimaryRef.Caption;
+	if (CaptionRef.EqualTo(InValue))
+	{
+		return;
+	}
+
+	CaptionRef = InValue;
+	CommitSettingValue(*SettingsRowPtr, FSettingValue::MakeText(InValue));
+}
+
+// Set new text for an input box
+void USettingsSubsystem::SetSettingUserInput(const FSettingTag& UserInputTag, FName InValue)
+{
+	if (!UserInputTag.IsValid())
+	{
+		return;
+	}
+
+	FSettingsPicker* SettingsRowPtr = SettingsTableRowsInternal.Find(UserInputTag.GetTagName());
+	if (!SettingsRowPtr)
+	{
+		return;
+	}
+
+	FSettingsUserInput& UserInputRef = SettingsRowPtr->UserInput;
+	if (UserInputRef.UserInput.IsEqual(InValue)
+		|| InValue.IsNone())
+	{
+		// Is not needed to update
+		return;
+	}
+
+	if (UserInputRef.MaxCharactersNumber > 0)
+	{
+		// Limit the length of the string
+		const FString NewValueStr = InValue.ToString().Left(UserInputRef.MaxCharactersNumber);
+		InValue = *NewValueStr;
+	}
+
+	UserInputRef.UserInput = InValue;
+	CommitSettingValue(*SettingsRowPtr, FSettingValue::MakeName(InValue));
+}
+
+// Set new custom widget for setting by specified tag
+void USettingsSubsystem::SetSettingCustomWidget(const FSettingTag& CustomWidgetTag, UObject* InCustomWidget)
+{
+	if (!CustomWidgetTag.IsValid())
+	{
+		return;
+	}
+
+	FSettingsPicker* SettingsRowPtr = SettingsTableRowsInternal.Find(CustomWidgetTag.GetTagName());
+	if (!SettingsRowPtr)
+	{
+		return;
+	}
+
+	TWeakObjectPtr<UObject>& CustomWidgetRef = CustomWidgetsInternal.FindOrAdd(CustomWidgetTag.GetTagName());
+	if (CustomWidgetRef == InCustomWidget)
+	{
+		return;
+	}
+
+	CustomWidgetRef = InCustomWidget;
+	if (SettingsRowPtr->CustomWidget.OnSetterWidget.IsBound())
+	{
+		FSettingsProfilerScope ProfilerScope(SettingsRowPtr->PrimaryData, ESettingsProfilerFunction::Setter, SettingsRowPtr->PrimaryData.Setter);
+		SettingsRowPtr->CustomWidget.OnSetterWidget.Execute(InCustomWidget);
+	}
+	InvalidateSettingCache(CustomWidgetTag);
+	UpdateSettingsByIds(GetSettingsToUpdateBits(SettingsRowPtr->PrimaryData.Tag));
+
+	OnSettingChanged.Broadcast(CustomWidgetTag);
+}
+
+// Returns the typed value of the setting of any type
+FSettingValue USettingsSubsystem::GetSettingTypedValue(const FSettingTag& SettingTag) const
+{
+	const FSettingsPicker& FoundRow = GetSettingRow(SettingTag);
+	const FSettingsDataBase* ChosenData = FoundRow.IsValid() ? FoundRow.GetChosenSettingsData() : nullptr;
+	if (!ChosenData)
+	{
+		return FSettingValue::Empty;
+	}
+
+	if (ChosenData == &FoundRow.Checkbox)
+	{
+		return FSettingValue::MakeBool(GetCheckboxValue(SettingTag));
+	}
+
+	if (ChosenData == &FoundRow.Combobox)
+	{
+		return FSettingValue::MakeInt(GetComboboxIndex(SettingTag));
+	}
+
+	if (ChosenData == &FoundRow.Slider)
+	{
+		return FSettingValue::MakeFloat(GetSliderValue(SettingTag));
+	}
+
+	if (ChosenData == &FoundRow.UserInput)
+	{
+		return FSettingValue::MakeName(GetUserInputValue(SettingTag));
+	}
+
+	if (ChosenData == &FoundRow.TextLine)
+	{
+		FText Value = TEXT_NONE;
+		GetTextLineValue(SettingTag, /*Out*/Value);
+		return FSettingValue::MakeText(Value);
+	}
+
+	return FSettingValue::Empty;
+}
+
+// Returns typed values of specified settings in one call without string conversion
+void USettingsSubsystem::GetSettingValues(const TArray<FSettingTag>& SettingTags, TArray<FSettingValue>& OutValues) const
+{
+	OutValues.Reset(SettingTags.Num());
+	for (const FSettingTag& SettingTagIt : SettingTags)
+	{
+		FSettingValue& ValueRef = OutValues.Emplace_GetRef(GetSettingTypedValue(SettingTagIt));
+		if (ValueRef.Type != ESettingValueType::Int)
+		{
+			continue;
+		}
+
+		// Combobox index makes sense only with its members, so both are returned to be set back together
+		TArray<FText> Members;
+		GetComboboxMembers(SettingTagIt, /*Out*/Members);
+		ValueRef = FSettingValue::MakeMembers(Members, ValueRef.IntValue);
+	}
+}
+
+// Returns is a checkbox toggled
+bool USettingsSubsystem::GetCheckboxValue(const FSettingTag& CheckboxTag) const
+{
+	if (!CheckboxTag.IsValid())
+	{
+		return false;
+	}
+	if (const FSettingValue* PendingValue = FindPendingValue(CheckboxTag, ESettingValueType::Bool))
+	{
+		return PendingValue->BoolValue;
+	}
+
+	const FSettingsPicker& FoundRow = GetSettingRow(CheckboxTag);
+	bool Value = false;
+	if (FoundRow.IsValid())
+	{
+		const FSettingsCheckbox& Data = FoundRow.Checkbox;
+		Value = Data.bIsSet;
+
+		if (Data.OnGetterBool.IsBound())
+		{
+			GetCachedGetterValue(FoundRow, ESettingsProfilerFunction::Getter, &FSettingsGetterCache::bIsSet, Value, [&Data](bool& OutValue)
+			{
+				OutValue = Data.OnGetterBool.Execute();
+			});
+		}
+	}
+	return Value;
+}
+
+// Returns chosen member index of a combobox
+int32 USettingsSubsystem::GetComboboxIndex(const FSettingTag& ComboboxTag) const
+{
+	if (const FSettingValue* PendingValue = FindPendingValue(ComboboxTag, ESettingValueType::Int))
+	{
+		return PendingValue->IntValue;
+	}
+
+	const FSettingsPicker& FoundRow = GetSettingRow(ComboboxTag);
+	int32 Value = false;
+	if (FoundRow.IsValid())
+	{
+		const FSettingsCombobox& Data = FoundRow.Combobox;
+		Value = Data.ChosenMemberIndex;
+
+		if (Data.OnGetterInt.IsBound())
+		{
+			GetCachedGetterValue(FoundRow, ESettingsProfilerFunction::Getter, &FSettingsGetterCache::ChosenMemberIndex, Value, [&Data](int32& OutValue)
+			{
+				OutValue = Data.OnGetterInt.Execute();
+			});
+		}
+	}
+	return Value;
+}
+
+// Get all members of a combobox
+void USettingsSubsystem::GetComboboxMembers(const FSettingTag& ComboboxTag, TArray<FText>& OutMembers) const
+{
+	const FSettingsPicker& FoundRow = GetSettingRow(ComboboxTag);
+	if (FoundRow.IsValid())
+	{
+		const FSettingsCombobox& Data = FoundRow.Combobox;
+		OutMembers = Data.Members;
+
+		// Async getter is never called here, last received members are returned until new ones are loaded
+		if (Data.OnGetMembers.IsBound()
+			&& !Data.bAsyncGetMembers)
+		{
+			GetCachedGetterValue(FoundRow, ESettingsProfilerFunction::GetMembers, &FSettingsGetterCache::Members, OutMembers, [&Data](TArray<FText>& OutValue)
+			{
+				Data.OnGetMembers.Execute(OutValue);
+			});
+		}
+	}
+}
+
+// Get current value of a slider [0...1]
+double USettingsSubsystem::GetSliderValue(const FSettingTag& SliderTag) const
+{
+	if (const FSettingValue* PendingValue = FindPendingValue(SliderTag, ESettingValueType::Float))
+	{
+		return PendingValue->FloatValue;
+	}
+
+	const FSettingsPicker& FoundRow = GetSettingRow(SliderTag);
+	double Value = 0.0;
+	if (FoundRow.IsValid())
+	{
+		const FSettingsSlider& Data = FoundRow.Slider;
+		Value = Data.ChosenValue;
+
+		if (Data.OnGetterFloat.IsBound())
+		{
+			GetCachedGetterValue(FoundRow, ESettingsProfilerFunction::Getter, &FSettingsGetterCache::ChosenValue, Value, [&Data](double& OutValue)
+			{
+				OutValue = Data.OnGetterFloat.Execute();
+			});
+		}
+	}
+	return Value;
+}
+
+// Get current text of a simple text widget
+void USettingsSubsystem::GetTextLineValue(const FSettingTag& TextLineTag, FText& OutText) const
+{
+	if (const FSettingValue* PendingValue = FindPendingValue(TextLineTag, ESettingValueType::Text))
+	{
+		OutText = PendingValue->TextValue;
+		return;
+	}
+
+	const FSettingsPicker& FoundRow = GetSettingRow(TextLineTag);
+	if (FoundRow.IsValid())
+	{
+		OutText = FoundRow.PrimaryData.Caption;
+
+		const FSettingsTextLine& Data = FoundRow.TextLine;
+		if (Data.OnGetterText.IsBound())
+		{
+			GetCachedGetterValue(FoundRow, ESettingsProfilerFunction::Getter, &FSettingsGetterCache::Text, OutText, [&Data](FText& OutValue)
+			{
+				Data.OnGetterText.Execute(OutValue);
+			});
+		}
+	}
+}
+
+// Get current input name of the text input
+FName USettingsSubsystem::GetUserInputValue(const FSettingTag& UserInputTag) const
+{
+	if (const FSettingValue* PendingValue = FindPendingValue(UserInputTag, ESettingValueType::Name))
+	{
+		return PendingValue->NameValue;
+	}
+
+	const FSettingsPicker& FoundRow = GetSettingRow(UserInputTag);
+	FName Value = NAME_None;
+	if (FoundRow.IsValid())
+	{
+		const FSettingsUserInput& Data = FoundRow.UserInput;
+		Value = Data.UserInput;
+
+		if (Data.OnGetterName.IsBound())
+		{
+			GetCachedGetterValue(FoundRow, ESettingsProfilerFunction::Getter, &FSettingsGetterCache::UserInput, Value, [&Data](FName& OutValue)
+			{
+				OutValue = Data.OnGetterName.Execute();
+			});
+		}
+	}
+	return Value;
+}
+
+// Get custom widget of the setting by specified tag
+UObject* USettingsSubsystem::GetCustomWidget(const FSettingTag& CustomWidgetTag) const
+{
+	const FSettingsPicker& FoundRow = GetSettingRow(CustomWidgetTag);
+	UObject* CustomWidget = nullptr;
+	if (FoundRow.IsValid())
+	{
+		const TWeakObjectPtr<UObject>* CustomWidgetPtr = CustomWidgetsInternal.Find(CustomWidgetTag.GetTagName());
+		CustomWidget = CustomWidgetPtr ? CustomWidgetPtr->Get() : nullptr;
+
+		const USettingFunctionTemplate::FOnGetterWidget& Getter = FoundRow.CustomWidget.OnGetterWidget;
+		if (Getter.IsBound())
+		{
+			FSettingsProfilerScope ProfilerScope(FoundRow.PrimaryData, ESettingsProfilerFunction::Getter, FoundRow.PrimaryData.Getter);
+			CustomWidget = Getter.Execute();
+		}
+	}
+	return CustomWidget;
+}
+
+
+// Bind and set static object delegate
+void USettingsSubsystem::TryBindStaticContext(FSettingsPrimary& Primary)
+{
+	UObject* FoundContextObj = nullptr;
+	if (UFunction* FunctionPtr = Primary.StaticContext.GetFunction())
+	{
+		FSettingsProfilerScope ProfilerScope(Primary, ESettingsProfilerFunction::StaticContext, Primary.StaticContext);
+		FunctionPtr->ProcessEvent(FunctionPtr, /*Out*/&FoundContextObj);
+	}
+
+	Primary.StaticContextFunctionList.Reset();
+	Primary.StaticContextObject = FoundContextObj;
+	if (!FoundContextObj)
+	{
+		return;
+	}
+
+	const UClass* ContextClass = FoundContextObj->GetClass();
+	if (!ensureMsgf(ContextClass, TEXT("ASSERT: 'ContextClass' is not valid")))
+	{
+		return;
+	}
+
+	// Cache all functions that are contained in returned object
+	for (TFieldIterator<UFunction> It(ContextClass, EFieldIteratorFlags::IncludeSuper); It; ++It)
+	{
+		const UFunction* FunctionIt = *It;
+		if (!FunctionIt)
+		{
+			continue;
+		}
+
+		const FName FunctionNameIt = FunctionIt->GetFName();
+		if (!FunctionNameIt.IsNone())
+		{
+			Primary.StaticContextFunctionList.Emplace(FunctionNameIt);
+		}
+	}
+}
+
+// Binds all getters and setters of specified setting to its Static Context object
+bool USettingsSubsystem::BindSetting(FSettingsPicker& Setting)
+{
+	FSettingsPrimary& Primary = Setting.PrimaryData;
+	TryBindStaticContext(Primary);
+
+	UObject* StaticContextObject = Primary.StaticContextObject.Get();
+	if (!StaticContextObject)
+	{
+		return false;
+	}
+
+	auto BindFunction = [&Primary, StaticContextObject](auto& Delegate, FName FunctionName)
+	{
+		if (Primary.StaticContextFunctionList.Contains(FunctionName))
+		{
+			Delegate.BindUFunction(StaticContextObject, FunctionName);
+		}
+	};
+
+	const FSettingsDataBase* ChosenData = Setting.GetChosenSettingsData();
+	if (ChosenData == &Setting.Button)
+	{
+		BindFunction(Setting.Button.OnButtonPressed, Primary.Setter.FunctionName);
+	}
+	else if (ChosenData == &Setting.Checkbox)
+	{
+		BindFunction(Setting.Checkbox.OnGetterBool, Primary.Getter.FunctionName);
+		BindFunction(Setting.Checkbox.OnSetterBool, Primary.Setter.FunctionName);
+	}
+	else if (ChosenData == &Setting.Combobox)
+	{
+		FSettingsCombobox& Data = Setting.Combobox;
+		BindFunction(Data.OnGetMembers, Data.GetMembers.FunctionName);
+		if (Data.bAsyncGetMembers)
+		{
+			RequestComboboxMembers(Primary.Tag);
+		}
+		else if (Data.OnGetMembers.IsBound())
+		{
+			FSettingsProfilerScope ProfilerScope(Primary, ESettingsProfilerFunction::GetMembers, Data.GetMembers);
+			Data.OnGetMembers.Execute(Data.Members);
+		}
+
+		BindFunction(Data.OnSetMembers, Data.SetMembers.FunctionName);
+		if (Data.OnSetMembers.IsBound())
+		{
+			FSettingsProfilerScope ProfilerScope(Primary, ESettingsProfilerFunction::SetMembers, Data.SetMembers);
+			Data.OnSetMembers.Execute(Data.Members);
+		}
+
+		BindFunction(Data.OnGetterInt, Primary.Getter.FunctionName);
+		BindFunction(Data.OnSetterInt, Primary.Setter.FunctionName);
+	}
+	else if (ChosenData == &Setting.Slider)
+	{
+		BindFunction(Setting.Slider.OnGetterFloat, Primary.Getter.FunctionName);
+		BindFunction(Setting.Slider.OnSetterFloat, Primary.Setter.FunctionName);
+	}
+	else if (ChosenData == &Setting.TextLine)
+	{
+		BindFunction(Setting.TextLine.OnGetterText, Primary.Getter.FunctionName);
+		BindFunction(Setting.TextLine.OnSetterText, Primary.Setter.FunctionName);
+	}
+	else if (ChosenData == &Setting.UserInput)
+	{
+		BindFunction(Setting.UserInput.OnGetterName, Primary.Getter.FunctionName);
+		BindFunction(Setting.UserInput.OnSetterName, Primary.Setter.FunctionName);
+	}
+	else if (ChosenData == &Setting.CustomWidget)
+	{
+		BindFunction(Setting.CustomWidget.OnGetterWidget, Primary.Getter.FunctionName);
+		BindFunction(Setting.CustomWidget.OnSetterWidget, Primary.Setter.FunctionName);
+	}
+
+	// Blueprint functions can be called only on the game thread, so thread-safe flags are accepted only for native functions
+	const auto IsNativeFunction = [StaticContextObject](FName FunctionName)
+	{
+		const UFunction* Function = FunctionName.IsNone() ? nullptr : StaticContextObject->FindFunction(FunctionName);
+		return !Function || Function->HasAnyFunctionFlags(FUNC_Native);
+	};
+	const bool bIsNativeGetter = IsNativeFunction(Primary.Getter.FunctionName)
+		&& (ChosenData != &Setting.Combobox || IsNativeFunction(Setting.Combobox.GetMembers.FunctionName));
+	if (!bIsNativeGetter)
+	{
+		Primary.bIsThreadSafeGetter = false;
+	}
+	if (!bIsNativeGetter
+		|| !IsNativeFunction(Primary.Setter.FunctionName))
+	{
+		Primary.bIsThreadSafe = false;
+	}
+
+	// Members and values might be changed by the new context
+	InvalidateSettingCache(Primary.Tag);
+
+	if (Primary.Tag.IsValid())
+	{
+		TagsByContextInternal.AddUnique(StaticContextObject, Primary.Tag.GetTagName());
+	}
+
+	return true;
+}
+
+// Returns cached getter results of specified setting or null if the setting is not cached
+FSettingsGetterCache* USettingsSubsystem::FindGetterCache(const FSettingTag& SettingTag) const
+{
+	return SettingTag.IsValid() ? GetterCacheInternal.Find(SettingTag.GetTagName()) : nullptr;
+}
+
+// Takes the result of the bound getter of specified setting from the cache, the getter is called only if the cached result is outdated
+template <typename T, typename TExecuteGetter>
+void USettingsSubsystem::GetCachedGetterValue(const FSettingsPicker& Setting, ESettingsProfilerFunction ProfilerFunction, T FSettingsGetterCache::* CachedValue, T& InOutValue, TExecuteGetter&& ExecuteGetter) const
+{
+	const bool bIsMembers = ProfilerFunction == ESettingsProfilerFunction::GetMembers;
+	uint32 FSettingsGetterCache::* CachedEpoch = bIsMembers ? &FSettingsGetterCache::MembersEpoch : &FSettingsGetterCache::GetterEpoch;
+
+	FSettingsGetterCache* GetterCache = FindGetterCache(Setting.PrimaryData.Tag);
+	if (GetterCache
+		&& !GetterCache->IsStale(GetterCache->*CachedEpoch, AllSettingsInvalidatedEpochInternal))
+	{
+		InOutValue = GetterCache->*CachedValue;
+		return;
+	}
+
+	// Getter might invalidate settings by itself, so stamp the result by the epoch before the call
+	const uint32 CurrentEpoch = SettingsEpochInternal;
+	{
+		const FSettingFunctionPicker& Function = bIsMembers ? Setting.Combobox.GetMembers : Setting.PrimaryData.Getter;
+		FSettingsProfilerScope ProfilerScope(Setting.PrimaryData, ProfilerFunction, Function);
+		ExecuteGetter(InOutValue);
+	}
+
+	if (GetterCache)
+	{
+		GetterCache->*CachedValue = InOutValue;
+		GetterCache->*CachedEpoch = CurrentEpoch;
+	}
+}
+
+// Marks cached getter results of specified setting as outdated, is called after its setter was executed
+void USettingsSubsystem::InvalidateSettingCache(const FSettingTag& SettingTag)
+{
+	if (FSettingsGetterCache* GetterCache = FindGetterCache(SettingTag))
+	{
+		GetterCache->InvalidatedEpoch = ++SettingsEpochInternal;
+	}
+}
+
+// Calls the setter of specified setting with its new value, then updates its Settings To Update and notifies about the change
+void USettingsSubsystem::CommitSettingValue(const FSettingsPicker& Setting, const FSettingValue& Value)
+{
+	if (StageSettingValue(Setting, Value))
+	{
+		// Real setter will be called on Apply
+		return;
+	}
+
+	const FSettingTag& SettingTag = Setting.PrimaryData.Tag;
+	ExecuteSetter(Setting, Value);
+	InvalidateSettingCache(SettingTag);
+	RecordSettingChange(SettingTag, Value);
+	UpdateSettingsByIds(GetSettingsToUpdateBits(SettingTag));
+
+	OnSettingValueCommitted(SettingTag, Value);
+	OnSettingChanged.Broadcast(SettingTag);
+}
@@ -18,8 +18,8 @@
   * @see FFunctionPicker
   */
 USTRUCT(BlueprintType, meta = (
-	FunctionContextTemplate = "/Script/SettingsWidgetConstructor.SettingFunctionTemplate::OnStaticContext__DelegateSignature"))
-struct SETTINGSWIDGETCONSTRUCTOR_API FSettingsDataBase
+	FunctionContextTemplate = "/Script/SettingsWidgetConstructorCore.SettingFunctionTemplate::OnStaticContext__DelegateSignature"))
+struct SETTINGSWIDGETCONSTRUCTORCORE_API FSettingsDataBase
 {
 	GENERATED_BODY()
 };
@@ -28,8 +28,8 @@ struct SETTINGSWIDGETCONSTRUCTOR_API FSettingsDataBase
   * The setting button data.
   */
 USTRUCT(BlueprintType, meta = (
-	FunctionSetterTemplate = "/Script/SettingsWidgetConstructor.SettingFunctionTemplate::OnButtonPressed__DelegateSignature"))
-struct SETTINGSWIDGETCONSTRUCTOR_API FSettingsButton : public FSettingsDataBase
+	FunctionSetterTemplate = "/Script/SettingsWidgetConstructorCore.SettingFunctionTemplate::OnButtonPressed__DelegateSignature"))
+struct SETTINGSWIDGETCONSTRUCTORCORE_API FSettingsButton : public FSettingsDataBase
 {
 	GENERATED_BODY()
 
@@ -49,9 +49,9 @@ struct SETTINGSWIDGETCONSTRUCTOR_API FSettingsButton : public FSettingsDataBase
   * The setting checkbox data.
   */
 USTRUCT(BlueprintType, meta = (
-	FunctionSetterTemplate = "/Script/SettingsWidgetConstructor.SettingFunctionTemplate::OnSetterBool__DelegateSignature",
-	FunctionGetterTemplate = "/Script/SettingsWidgetConstructor.SettingFunctionTemplate::OnGetterBool__DelegateSignature"))
-struct SETTINGSWIDGETCONSTRUCTOR_API FSettingsCheckbox : public FSettingsDataBase
+	FunctionSetterTemplate = "/Script/SettingsWidgetConstructorCore.SettingFunctionTemplate::OnSetterBool__DelegateSignature",
+	FunctionGetterTemplate = "/Script/SettingsWidgetConstructorCore.SettingFunctionTemplate::OnGetterBool__DelegateSignature"))
+struct SETTINGSWIDGETCONSTRUCTORCORE_API FSettingsCheckbox : public FSettingsDataBase
 {
 	GENERATED_BODY()
 
@@ -69,24 +69,30 @@ struct SETTINGSWIDGETCONSTRUCTOR_API FSettingsCheckbox : public FSettingsDataBas
   * The setting combobox data.
   */
 USTRUCT(BlueprintType, meta = (
-	FunctionSetterTemplate = "/Script/SettingsWidgetConstructor.SettingFunctionTemplate::OnSetterInt__DelegateSignature",
-	FunctionGetterTemplate = "/Script/SettingsWidgetConstructor.SettingFunctionTemplate::OnGetterInt__DelegateSignature"))
-struct SETTINGSWIDGETCONSTRUCTOR_API FSettingsCombobox : public FSettingsDataBase
+	FunctionSetterTemplate = "/Script/SettingsWidgetConstructorCore.SettingFunctionTemplate::OnSetterInt__DelegateSignature",
+	FunctionGetterTemplate = "/Script/SettingsWidgetConstructorCore.SettingFunctionTemplate::OnGetterInt__DelegateSignature"))
+struct SETTINGSWIDGETCONSTRUCTORCORE_API FSettingsCombobox : public FSettingsDataBase
 {
 	GENERATED_BODY()
 
 	/** The Setter function to be called to set all combobox members. */
-	UPROPERTY(EditDefaultsOnly, meta = (FunctionSetterTemplate = "/Script/SettingsWidgetConstructor.SettingFunctionTemplate::OnSetMembers__DelegateSignature"))
+	UPROPERTY(EditDefaultsOnly, meta = (FunctionSetterTemplate = "/Script/SettingsWidgetConstructorCore.SettingFunctionTemplate::OnSetMembers__DelegateSignature"))
 	FSettingFunctionPicker SetMembers = FSettingFunctionPicker::EmptySettingFunction;
 
 	/** The Setter function to be called to get all combobox members. */
-	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, meta = (FunctionGetterTemplate = "/Script/SettingsWidgetConstructor.SettingFunctionTemplate::OnGetMembers__DelegateSignature"))
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, meta = (FunctionGetterTemplate = "/Script/SettingsWidgetConstructorCore.SettingFunctionTemplate::OnGetMembers__DelegateSignature"))
 	FSettingFunctionPicker GetMembers = FSettingFunctionPicker::EmptySettingFunction;
 
 	/** Contains all combobox members. */
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly)
 	TArray<FText> Members;
 
+	/** Set true for slow Get Members like enumeration of supported resolutions or audio devices, so opening of the menu never waits for it.
+	 * Is called in background if the setting is thread-safe or on next frame otherwise, the combobox shows a loading state until members are received.
+	 * @see FSettingsPrimary::bIsThreadSafe */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, AdvancedDisplay)
+	bool bAsyncGetMembers = false;
+
 	/** Text alignment either left, center, or right. */
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly)
 	TEnumAsByte<ETextJustify::Type> TextJustify = ETextJustify::Center;
@@ -111,9 +117,9 @@ struct SETTINGSWIDGETCONSTRUCTOR_API FSettingsCombobox : public FSettingsDataBas
   * The setting slider data.
   */
 USTRUCT(BlueprintType, meta = (
-	FunctionSetterTemplate = "/Script/SettingsWidgetConstructor.SettingFunctionTemplate::OnSetterFloat__DelegateSignature",
-	FunctionGetterTemplate = "/Script/SettingsWidgetConstructor.SettingFunctionTemplate::OnGetterFloat__DelegateSignature"))
-struct SETTINGSWIDGETCONSTRUCTOR_API FSettingsSlider : public FSettingsDataBase
+	FunctionSetterTemplate = "/Script/SettingsWidgetConstructorCore.SettingFunctionTemplate::OnSetterFloat__DelegateSignature",
+	FunctionGetterTemplate = "/Script/SettingsWidgetConstructorCore.SettingFunctionTemplate::OnGetterFloat__DelegateSignature"))
+struct SETTINGSWIDGETCONSTRUCTORCORE_API FSettingsSlider : public FSettingsDataBase
 {
 	GENERATED_BODY()
 
@@ -131,9 +137,9 @@ struct SETTINGSWIDGETCONSTRUCTOR_API FSettingsSlider : public FSettingsDataBase
   * The setting text line data.
   */
 USTRUCT(BlueprintType, meta = (
-	FunctionSetterTemplate = "/Script/SettingsWidgetConstructor.SettingFunctionTemplate::OnSetterText__DelegateSignature",
-	FunctionGetterTemplate = "/Script/SettingsWidgetConstructor.SettingFunctionTemplate::OnGetterText__DelegateSignature"))
-struct SETTINGSWIDGETCONSTRUCTOR_API FSettingsTextLine : public FSettingsDataBase
+	FunctionSetterTemplate = "/Script/SettingsWidgetConstructorCore.SettingFunctionTemplate::OnSetterText__DelegateSignature",
+	FunctionGetterTemplate = "/Script/SettingsWidgetConstructorCore.SettingFunctionTemplate::OnGetterText__DelegateSignature"))
+struct SETTINGSWIDGETCONSTRUCTORCORE_API FSettingsTextLine : public FSettingsDataBase
 {
 	GENERATED_BODY()
 
@@ -156,9 +162,9 @@ struct SETTINGSWIDGETCONSTRUCTOR_API FSettingsTextLine : public FSettingsDataBas
   * The setting user input data.
   */
 USTRUCT(BlueprintType, meta = (
-	FunctionSetterTemplate = "/Script/SettingsWidgetConstructor.SettingFunctionTemplate::OnSetterName__DelegateSignature",
-	FunctionGetterTemplate = "/Script/SettingsWidgetConstructor.SettingFunctionTemplate::OnGetterName__DelegateSignature"))
-struct SETTINGSWIDGETCONSTRUCTOR_API FSettingsUserInput : public FSettingsDataBase
+	FunctionSetterTemplate = "/Script/SettingsWidgetConstructorCore.SettingFunctionTemplate::OnSetterName__DelegateSignature",
+	FunctionGetterTemplate = "/Script/SettingsWidgetConstructorCore.SettingFunctionTemplate::OnGetterName__DelegateSignature"))
+struct SETTINGSWIDGETCONSTRUCTORCORE_API FSettingsUserInput : public FSettingsDataBase
 {
 	GENERATED_BODY()
 
@@ -181,15 +187,20 @@ struct SETTINGSWIDGETCONSTRUCTOR_API FSettingsUserInput : public FSettingsDataBa
   * The setting user input data.
   */
 USTRUCT(BlueprintType, meta = (
-	FunctionSetterTemplate = "/Script/SettingsWidgetConstructor.SettingFunctionTemplate::OnSetterWidget__DelegateSignature",
-	FunctionGetterTemplate = "/Script/SettingsWidgetConstructor.SettingFunctionTemplate::OnGetterWidget__DelegateSignature"))
-struct SETTINGSWIDGETCONSTRUCTOR_API FSettingsCustomWidget : public FSettingsDataBase
+	FunctionSetterTemplate = "/Script/SettingsWidgetConstructorCore.SettingFunctionTemplate::OnSetterWidget__DelegateSignature",
+	FunctionGetterTemplate = "/Script/SettingsWidgetConstructorCore.SettingFunctionTemplate::OnGetterWidget__DelegateSignature"))
+struct SETTINGSWIDGETCONSTRUCTORCORE_API FSettingsCustomWidget : public FSettingsDataBase
 {
 	GENERATED_BODY()
 
 	/** Contains created custom widget of the setting. */
-	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, meta = (ShowOnlyInnerProperties))
-	TSubclassOf<class USettingCustomWidget> CustomWidgetClass = nullptr;
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, meta = (ShowOnlyInnerProperties, AllowedClasses = "/Script/SettingsWidgetConstructor.SettingCustomWidget"))
+	TSubclassOf<UObject> CustomWidgetClass = nullptr;
+
+	/** The declared height of the custom widget, is used to lay out sections before the widget is painted.
+	 * Line Height is used if it is higher or this value is 0. */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, meta = (ClampMin = "0"))
+	float DesiredHeight = 0.f;
 
 	/** The cached bound delegate, is executed to set the custom widget. */
 	USettingFunctionTemplate::FOnGetterWidget OnGetterWidget;
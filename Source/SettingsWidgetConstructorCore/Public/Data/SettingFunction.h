@@ -2,8 +2,8 @@
 
 #pragma once
 
-#include "SettingsWidgetConstructor/Private/FunctionPickerData/SWCFunctionPicker.h"
-#include "SettingsWidgetConstructor/Private/FunctionPickerData/SWCFunctionPickerTemplate.h"
+#include "SettingsWidgetConstructorCore/Private/FunctionPickerData/SWCFunctionPicker.h"
+#include "SettingsWidgetConstructorCore/Private/FunctionPickerData/SWCFunctionPickerTemplate.h"
 //---
 #include "SettingFunction.generated.h"
 
@@ -11,7 +11,7 @@
  * Is used to select setting function to be called
  */
 USTRUCT(BlueprintType)
-struct SETTINGSWIDGETCONSTRUCTOR_API FSettingFunctionPicker : public FSWCFunctionPicker
+struct SETTINGSWIDGETCONSTRUCTORCORE_API FSettingFunctionPicker : public FSWCFunctionPicker
 {
 	GENERATED_BODY()
 
@@ -31,12 +31,14 @@ struct SETTINGSWIDGETCONSTRUCTOR_API FSettingFunctionPicker : public FSWCFunctio
   * see UFunctionPickerTemplate
   */
 UCLASS(Abstract, Const, Transient)
-class SETTINGSWIDGETCONSTRUCTOR_API USettingFunctionTemplate : public USWCFunctionPickerTemplate
+class SETTINGSWIDGETCONSTRUCTORCORE_API USettingFunctionTemplate : public USWCFunctionPickerTemplate
 {
 	GENERATED_BODY()
 
 public:
-	DECLARE_DYNAMIC_DELEGATE_OneParam(FOnSetterWidget, class USettingCustomWidget*, Param);
+	/** Custom widgets are UI classes and live in the dependent module, so they are passed as objects.
+	 * Any function with USettingCustomWidget or its child as the param is still compatible. */
+	DECLARE_DYNAMIC_DELEGATE_OneParam(FOnSetterWidget, UObject*, Param);
 
-	DECLARE_DYNAMIC_DELEGATE_RetVal(class USettingCustomWidget*, FOnGetterWidget);
+	DECLARE_DYNAMIC_DELEGATE_RetVal(UObject*, FOnGetterWidget);
 };
@@ -10,7 +10,7 @@
  * Used to require all such tags start with 'Settings.X' as it specified in USTRUCT meta.
  */
 USTRUCT(BlueprintType, meta = (Categories = "Settings"))
-struct SETTINGSWIDGETCONSTRUCTOR_API FSettingTag : public FGameplayTag
+struct SETTINGSWIDGETCONSTRUCTORCORE_API FSettingTag : public FGameplayTag
 {
 	GENERATED_BODY()
 
@@ -28,7 +28,7 @@ struct SETTINGSWIDGETCONSTRUCTOR_API FSettingTag : public FGameplayTag
 /**
  * Allows automatically add native setting tags at startup.
  */
-struct SETTINGSWIDGETCONSTRUCTOR_API FGlobalSettingTags : public FGameplayTagNativeAdder
+struct SETTINGSWIDGETCONSTRUCTORCORE_API FGlobalSettingTags : public FGameplayTagNativeAdder
 {
 	FSettingTag ButtonSettingTag = FSettingTag::EmptySettingTag;
 	FSettingTag CheckboxSettingTag = FSettingTag::EmptySettingTag;
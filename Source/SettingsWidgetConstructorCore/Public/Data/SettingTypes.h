@@ -62,3 +62,24 @@ enum class ESettingsSliderState : uint8
 	NormalThumb,
 	HoveredThumb
 };
+
+/**
+  * Defines when the Setter of the setting is called after its value was changed.
+  * Values of not immediate settings are queued, only the last value of each setting is applied.
+  */
+UENUM(BlueprintType)
+enum class ESettingExecution : uint8
+{
+	/** Is called right away, or on Apply if changes are staged. */
+	Immediate,
+	/** Is called on next frame, so several changes during one frame are applied once. */
+	NextFrame,
+	/** Is called only on Apply or Save, even if changes are not staged. */
+	OnApply,
+	/** Is called right before next map is loaded, e.g: texture pool size. */
+	OnLevelLoad,
+	/** Is called on Save to store the value, but takes effect only after restart, e.g: RHI or language. */
+	OnRestart,
+	/** Is called in background if the setting is thread-safe, e.g: file or device writes, Settings To Update are updated once it completes. */
+	Async
+};
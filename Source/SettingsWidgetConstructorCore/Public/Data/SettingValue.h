@@ -0,0 +1,79 @@
+﻿// Copyright (c) Yevhenii Selivanov
+
+#pragma once
+
+#include "SettingValue.generated.h"
+
+/**
+  * Types of values that can be returned by getters and passed to setters of settings.
+  */
+UENUM(BlueprintType)
+enum class ESettingValueType : uint8
+{
+	None,
+	Bool, // Checkbox
+	Int, // Combobox
+	Float, // Slider
+	Name, // User Input
+	Text, // Text Line
+	Members // Combobox members with the chosen index
+};
+
+/**
+  * The typed value of any setting, is used to get, set and save values without knowing the setting archetype.
+  * Only the member of its type is used.
+  */
+USTRUCT(BlueprintType)
+struct SETTINGSWIDGETCONSTRUCTORCORE_API FSettingValue
+{
+	GENERATED_BODY()
+
+	/** Value that contains nothing. */
+	static const FSettingValue Empty;
+
+	/** The type of this value. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	ESettingValueType Type = ESettingValueType::None;
+
+	/** The value of Bool type. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, meta = (EditCondition = "Type == ESettingValueType::Bool", EditConditionHides))
+	bool BoolValue = false;
+
+	/** The value of Int type, or the chosen member index of Members type that is not changed if INDEX_NONE. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, meta = (EditCondition = "Type == ESettingValueType::Int || Type == ESettingValueType::Members", EditConditionHides))
+	int32 IntValue = INDEX_NONE;
+
+	/** The value of Float type. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, meta = (EditCondition = "Type == ESettingValueType::Float", EditConditionHides))
+	double FloatValue = 0.0;
+
+	/** The value of Name type. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, meta = (EditCondition = "Type == ESettingValueType::Name", EditConditionHides))
+	FName NameValue = NAME_None;
+
+	/** The value of Text type. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, meta = (EditCondition = "Type == ESettingValueType::Text", EditConditionHides))
+	FText TextValue = FText::GetEmpty();
+
+	/** The value of Members type. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, meta = (EditCondition = "Type == ESettingValueType::Members", EditConditionHides))
+	TArray<FText> MembersValue;
+
+	/** Creates the value of specified type. */
+	static FSettingValue MakeBool(bool InValue);
+	static FSettingValue MakeInt(int32 InValue);
+	static FSettingValue MakeFloat(double InValue);
+	static FSettingValue MakeName(FName InValue);
+	static FSettingValue MakeText(const FText& InValue);
+	static FSettingValue MakeMembers(const TArray<FText>& InValue, int32 InChosenIndex = INDEX_NONE);
+
+	/** Returns true if contains any value. */
+	FORCEINLINE bool IsValid() const { return Type != ESettingValueType::None; }
+
+	/** Compares the types and values of their types. */
+	bool operator==(const FSettingValue& Other) const;
+	FORCEINLINE bool operator!=(const FSettingValue& Other) const { return !(*this == Other); }
+
+	/** Serializes the type and only the value of this type. */
+	friend SETTINGSWIDGETCONSTRUCTORCORE_API FArchive& operator<<(FArchive& Ar, FSettingValue& Value);
+};
@@ -0,0 +1,47 @@
+﻿// Copyright (c) Yevhenii Selivanov
+
+#pragma once
+
+#include "Data/SettingValue.h"
+
+/**
+ * Compact binary save of settings that keeps only values which differ from their defaults,
+ * so its load and save cost depends on the amount of changed settings instead of the amount of config sections.
+ * Layout: [Magic][Version][Records num][Records: Tag name, Typed value...]
+ * @see USettingsCoreDataAsset::bUseBinarySaveInternal
+ */
+class SETTINGSWIDGETCONSTRUCTORCORE_API FSettingsBinarySave
+{
+public:
+	/** Is written first to recognize the file. */
+	static constexpr uint32 Magic = 0x53574353; // SWCS
+
+	/** Versions of the file layout, add new one before LatestPlusOne on any change. */
+	enum EVersion : int32
+	{
+		Initial = 1,
+		// -----<new versions can be added above this line>-----
+		LatestPlusOne,
+		Latest = LatestPlusOne - 1
+	};
+
+	/** Is called for each loaded record of older version, allows to rename the tag or convert the value.
+	 * @return false to drop the record. */
+	DECLARE_DELEGATE_RetVal_ThreeParams(bool, FOnMigrateSettingValue, int32 /*SavedVersion*/, FName& /*InOutTag*/, FSettingValue& /*InOutValue*/);
+	static FOnMigrateSettingValue OnMigrateSettingValue;
+
+	/** Returns the path of the save file in the Saved folder of the project. */
+	static FString GetFilename();
+
+	/** Reads all saved values from specified file.
+	 * @return false if the file doesn't exist or is corrupted, then OutValues are empty. */
+	static bool LoadFromFile(const FString& Filename, TMap<FName, FSettingValue>& OutValues);
+
+	/** Writes specified values into the temporary file and replaces specified file by it, so the save is never half-written.
+	 * @return false if the values failed to be written, then the temporary file is deleted and specified file is kept. */
+	static bool SaveToFile(const FString& Filename, const TMap<FName, FSettingValue>& Values);
+
+	/** Reads or writes all values by specified archive.
+	 * @return false if the data is not recognized. */
+	static bool Serialize(FArchive& Ar, TMap<FName, FSettingValue>& InOutValues);
+};
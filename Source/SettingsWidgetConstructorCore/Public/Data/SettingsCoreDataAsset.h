@@ -0,0 +1,91 @@
+﻿// Copyright (c) Yevhenii Selivanov
+
+#pragma once
+
+#include "Engine/DeveloperSettings.h"
+//---
+#include "SettingsCoreDataAsset.generated.h"
+
+class USettingsDataTable;
+
+/**
+ * Contains settings data of the Constructor Widget plugin that is required without any UI, e.g: on dedicated servers and in tools.
+ * Is set up in 'Project Settings' -> "Plugins" -> "Settings Widget Constructor Core".
+ */
+UCLASS(Config = SettingsWidgetConstructor, DefaultConfig, DisplayName = "Settings Widget Constructor Core")
+class SETTINGSWIDGETCONSTRUCTORCORE_API USettingsCoreDataAsset : public UDeveloperSettings
+{
+	GENERATED_BODY()
+
+public:
+	/** Returns Project Settings Core Data of the Settings Widget Constructor plugin. */
+	static const FORCEINLINE USettingsCoreDataAsset& Get() { return *GetDefault<ThisClass>(); }
+
+	/** Returns Project Settings Core Data of the Settings Widget Constructor plugin. */
+	UFUNCTION(BlueprintPure, Category = "Settings Widget Constructor")
+	static const FORCEINLINE USettingsCoreDataAsset* GetSettingsCoreDataAsset() { return &Get(); }
+
+	/** Gets the container name for the settings, either Project or Editor */
+	virtual FName GetContainerName() const override { return TEXT("Project"); }
+
+	/** Gets the category for the settings, some high level grouping like, Editor, Engine, Game...etc. */
+	virtual FName GetCategoryName() const override { return TEXT("Plugins"); }
+
+	/** Returns the data table. */
+	UFUNCTION(BlueprintPure, Category = "Settings Widget Constructor")
+	USettingsDataTable* GetSettingsDataTable() const;
+
+	/** Returns true if values persisted in configs are applied on game start without constructing the Settings Widget. */
+	UFUNCTION(BlueprintPure, Category = "Settings Widget Constructor")
+	FORCEINLINE bool IsApplySettingsOnBoot() const { return bApplySettingsOnBootInternal; }
+
+	/** Returns true if changed values are kept as pending until Apply by default. */
+	UFUNCTION(BlueprintPure, Category = "Settings Widget Constructor")
+	FORCEINLINE bool IsStageChanges() const { return bStageChangesInternal; }
+
+	/** Returns true if changed values are saved into the compact binary file instead of configs of Static Context objects. */
+	UFUNCTION(BlueprintPure, Category = "Settings Widget Constructor")
+	FORCEINLINE bool IsUseBinarySave() const { return bUseBinarySaveInternal; }
+
+	/** Returns true if each changed value is appended to the journal to be recovered after crash. */
+	UFUNCTION(BlueprintPure, Category = "Settings Widget Constructor")
+	FORCEINLINE bool IsUseJournal() const { return bUseJournalInternal; }
+
+	/** Returns the interval in seconds to compact the journal into the binary save, 0 means it is compacted only on Save Settings. */
+	UFUNCTION(BlueprintPure, Category = "Settings Widget Constructor")
+	FORCEINLINE float GetJournalCompactionInterval() const { return JournalCompactionIntervalInternal; }
+
+protected:
+	/** The data table with all settings, is config property. */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Config, Category = "Settings Widget Constructor", meta = (BlueprintProtected, DisplayName = "Settings Data Table", ShowOnlyInnerProperties))
+	TSoftObjectPtr<USettingsDataTable> SettingsDataTableInternal;
+
+	/** If true, values persisted in configs are applied by their setters on game start and after each map load, so they don't wait for the Settings Widget, is config property.
+	 * Is disabled by default, since setters are called on boot and might run on workers for thread-safe rows, so enable it once setters are ready for that.
+	 * @see USettingsSubsystem::ApplySettingsOnBoot */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Config, Category = "Settings Widget Constructor", meta = (BlueprintProtected, DisplayName = "Apply Settings On Boot", ShowOnlyInnerProperties))
+	bool bApplySettingsOnBootInternal = false;
+
+	/** If true, changed values are kept as pending and shown by UI, but their setters are called only on Apply or Save in one batch,
+	 * so browsing expensive settings like shadow quality doesn't apply each step; rows marked as live are still applied right away, is config property.
+	 * @see FSettingsPrimary::bIsLive */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Config, Category = "Settings Widget Constructor", meta = (BlueprintProtected, DisplayName = "Stage Changes", ShowOnlyInnerProperties))
+	bool bStageChangesInternal = false;
+
+	/** If true, only values that differ from configs are saved into the compact binary file, configs of Static Context objects are not rewritten, is config property.
+	 * @see FSettingsBinarySave */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Config, Category = "Settings Widget Constructor", meta = (BlueprintProtected, DisplayName = "Use Binary Save", ShowOnlyInnerProperties))
+	bool bUseBinarySaveInternal = false;
+
+	/** If true, each changed value is appended to the journal and flushed right away, so changes are recovered on next boot if the game crashes before settings are saved, is config property.
+	 * @see FSettingsJournal */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Config, Category = "Settings Widget Constructor", meta = (BlueprintProtected, DisplayName = "Use Journal", EditCondition = "bUseBinarySaveInternal", ShowOnlyInnerProperties))
+	bool bUseJournalInternal = true;
+
+	/** The interval in seconds to compact the journal into the binary save, 0 means it is compacted only on Save Settings, is config property. */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Config, Category = "Settings Widget Constructor", meta = (BlueprintProtected, DisplayName = "Journal Compaction Interval", ClampMin = "0", EditCondition = "bUseBinarySaveInternal && bUseJournalInternal", ShowOnlyInnerProperties))
+	float JournalCompactionIntervalInternal = 60.f;
+
+	/** Is overridden to read the data table from the config section of the UI settings, where it was stored before. */
+	virtual void PostInitProperties() override;
+};
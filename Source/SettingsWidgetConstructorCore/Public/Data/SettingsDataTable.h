@@ -0,0 +1,47 @@
+﻿// Copyright (c) Yevhenii Selivanov.
+
+#pragma once
+
+#include "SettingsWidgetConstructorCore/Private/MyDataTable/SWCMyDataTable.h"
+//---
+#include "Data/SettingsRow.h"
+//---
+#include "SettingsDataTable.generated.h"
+
+/**
+ * Settings data table with FSettingsRow members.
+ * Provides additional in-editor functionality like automatic set the key name by specified setting tag.
+ */
+UCLASS(BlueprintType)
+class SETTINGSWIDGETCONSTRUCTORCORE_API USettingsDataTable : public USWCMyDataTable
+{
+	GENERATED_BODY()
+
+public:
+	/** Default constructor to set members as FSettingsRow. */
+	USettingsDataTable();
+
+	/** Returns the table rows.
+	 * @see USettingsCoreDataAsset::SettingsDataTableInternal */
+	UFUNCTION(BlueprintCallable, Category = "Settings Widget Constructor")
+	void GetSettingRows(TMap<FName, FSettingsRow>& OutRows) const { GetRows(OutRows); }
+
+#if WITH_EDITOR
+	/** Exchanges all rows with specified table without copying them, is used to replace rows by the imported ones at once.
+	 * @see FSettingsDataTableImporter */
+	void SwapRows(USettingsDataTable& OtherTable);
+#endif // WITH_EDITOR
+
+protected:
+#if WITH_EDITOR
+	/** Called on every change in this data table to automatic set the key name by specified setting tag. */
+	virtual void OnThisDataTableChanged(FName RowKey, const uint8& RowData) override;
+
+	/** Is called on saving to validate this table during cook, dead bindings fail the cook, while cycles and fan-outs are warnings.
+	 * @see FSettingsDataTableValidator */
+	virtual void PreSave(FObjectPreSaveContext ObjectSaveContext) override;
+
+	/** Validates cycles, dead bindings and fan-outs of this table by the Data Validation. */
+	virtual EDataValidationResult IsDataValid(TArray<FText>& ValidationErrors) override;
+#endif // WITH_EDITOR
+};
@@ -0,0 +1,128 @@
+﻿// Copyright (c) Yevhenii Selivanov
+
+#pragma once
+
+class USettingsDataTable;
+struct FSettingsPicker;
+struct FSettingsRow;
+struct FSettingFunctionPicker;
+
+/**
+  * How critical the found problem of the settings table is.
+  */
+enum class ESettingsValidationSeverity : uint8
+{
+	/** Is reported, but does not fail the cook. */
+	Warning,
+	/** Fails the cook. */
+	Error
+};
+
+/**
+  * One problem found in the settings table.
+  */
+struct SETTINGSWIDGETCONSTRUCTORCORE_API FSettingsValidationIssue
+{
+	/** How critical the problem is. */
+	ESettingsValidationSeverity Severity = ESettingsValidationSeverity::Warning;
+
+	/** The row where problem is found. */
+	FName RowName = NAME_None;
+
+	/** The description of the problem. */
+	FString Message;
+
+	/** Returns 'Error' or 'Warning'. */
+	const TCHAR* GetSeverityName() const;
+};
+
+/**
+  * Worst-case cost of changing one setting: how many other settings are updated by its SettingsToUpdate chain.
+  * Each updated setting calls its setter and updates its own SettingsToUpdate, so the same setting might be updated many times in one cascade.
+  */
+struct SETTINGSWIDGETCONSTRUCTORCORE_API FSettingsPropagationCost
+{
+	/** The row which setting is changed. */
+	FName RowName = NAME_None;
+
+	/** Amount of unique settings that are updated after change of this setting. */
+	int32 ReachableNum = 0;
+
+	/** Amount of setter calls in the whole cascade, duplicates included. */
+	int64 CascadeCallsNum = 0;
+
+	/** Is true if the cascade reaches any cycle, so its size depends on values and can't be counted statically.
+	 * Cycles converge, since setters skip unchanged values. */
+	bool bIsUnbounded = false;
+};
+
+/**
+  * The result of the settings table validation.
+  */
+struct SETTINGSWIDGETCONSTRUCTORCORE_API FSettingsValidationReport
+{
+	/** The path name of validated table. */
+	FString TablePathName;
+
+	/** Amount of validated rows. */
+	int32 RowsNum = 0;
+
+	/** All found problems. */
+	TArray<FSettingsValidationIssue> Issues;
+
+	/** Rows of each found cycle of SettingsToUpdate chains, are reported as warnings. */
+	TArray<TArray<FName>> Cycles;
+
+	/** Propagation costs of all rows that update other settings, the most expensive first. */
+	TArray<FSettingsPropagationCost> PropagationCosts;
+
+	/** Returns amount of issues of specified severity. */
+	int32 GetIssuesNum(ESettingsValidationSeverity Severity) const;
+
+	/** Returns true if at least one error is found. */
+	FORCEINLINE bool HasErrors() const { return GetIssuesNum(ESettingsValidationSeverity::Error) > 0; }
+
+	/** Adds new problem to the report. */
+	void AddIssue(ESettingsValidationSeverity Severity, FName RowName, const FString& Message);
+
+	/** Prints all found problems into the log. */
+	void LogIssues() const;
+};
+
+/**
+  * Validates the settings data table without creating any UI, so it can be run by commandlet or during cook:
+  * - resolves Static Context, Setter, Getter and combobox members functions of each row to find dead bindings;
+  * - builds the dependency graph of SettingsToUpdate to find cycles that repeat updates until values stop changing;
+  * - calculates the worst-case propagation size of each row to find enormous fan-outs.
+  * @see USettingsValidateCommandlet
+  */
+class SETTINGSWIDGETCONSTRUCTORCORE_API FSettingsDataTableValidator
+{
+public:
+	/** The default amount of setter calls in one cascade after which the row is reported. */
+	static constexpr int32 DefaultMaxPropagationSize = 32;
+
+	/** Validates all rows of specified settings table.
+	  * @param SettingsDataTable The table to validate.
+	  * @param MaxPropagationSize Rows which change causes more setter calls than that are reported as warnings. */
+	static FSettingsValidationReport Validate(const USettingsDataTable& SettingsDataTable, int32 MaxPropagationSize = DefaultMaxPropagationSize);
+
+protected:
+	/** Resolves all bound functions of specified row and reports the ones that can't be bound at runtime,
+	  * or that are blueprint functions of the setting marked as thread-safe, so the flag is ignored. */
+	static void ValidateBindings(FName RowName, const FSettingsPicker& SettingsPicker, FSettingsValidationReport& InOutReport);
+
+	/** Reports specified Setter or Getter if it can't be found in the class of Static Context object.
+	  * @param ContextClass The class returned by Static Context function, is null if unknown.
+	  * @param TemplateMetaValue The signature this function has to match, is empty if any signature is allowed. */
+	static void ValidateFunction(FName RowName, const TCHAR* FunctionKind, const FSettingFunctionPicker& FunctionPicker, const UClass* ContextClass, const FString& TemplateMetaValue, FSettingsValidationReport& InOutReport);
+
+	/** Builds the dependency graph of SettingsToUpdate, reports its cycles and the worst-case propagation size of each row. */
+	static void ValidateGraph(const TMap<FName, FSettingsRow>& SettingRows, int32 MaxPropagationSize, FSettingsValidationReport& InOutReport);
+
+	/** Returns the template function by its meta value like '/Script/ModuleName.ClassName::FunctionName'. */
+	static const UFunction* FindTemplateFunction(const FString& TemplateMetaValue);
+
+	/** Returns the meta value of specified key from the struct or any of its parents, is empty if not found. */
+	static FString FindTemplateMetaValue(const UStruct* Struct, FName MetaKey);
+};
@@ -0,0 +1,71 @@
+﻿// Copyright (c) Yevhenii Selivanov
+
+#pragma once
+
+#include "Data/SettingValue.h"
+
+/**
+ * Append-only journal of changed settings values, is written next to the binary save.
+ * Each change is appended as a tiny typed record and flushed to disk right away, so its cost does not depend on the amount of settings,
+ * and changes are not lost if the game crashes before the settings are saved.
+ * The journal is compacted into the binary save when settings are saved or by interval, and is replayed over the binary save on boot.
+ * Layout: [Magic][Version][Records: Size, Tag name, Typed value, Checksum...]
+ * A record that was not completely written is detected by its size and checksum and is ignored with all next records.
+ * @see USettingsCoreDataAsset::bUseJournalInternal
+ */
+class SETTINGSWIDGETCONSTRUCTORCORE_API FSettingsJournal
+{
+public:
+	/** Is written first to recognize the file. */
+	static constexpr uint32 Magic = 0x4A574353; // SWCJ
+
+	/** Versions of the file layout, add new one before LatestPlusOne on any change. */
+	enum EVersion : int32
+	{
+		Initial = 1,
+		// -----<new versions can be added above this line>-----
+		LatestPlusOne,
+		Latest = LatestPlusOne - 1
+	};
+
+	/** Closes the journal file if opened. */
+	~FSettingsJournal();
+
+	/** Returns the path of the journal file in the Saved folder of the project. */
+	static FString GetFilename();
+
+	/** Reads all complete records of specified journal and overrides by them specified values.
+	 * @return the amount of replayed records. */
+	static int32 Replay(const FString& Filename, TMap<FName, FSettingValue>& InOutValues);
+
+	/** Opens specified journal to append new records, all existing records are discarded, so it has to be replayed before. */
+	bool Open(const FString& Filename);
+
+	/** Closes the journal file, its records are kept. */
+	void Close();
+
+	/** Returns true if the journal is opened to append records. */
+	FORCEINLINE bool IsOpened() const { return FileWriterInternal.IsValid(); }
+
+	/** Returns the amount of records appended after the journal was opened or reset. */
+	FORCEINLINE int32 GetRecordsNum() const { return RecordsNumInternal; }
+
+	/** Appends the record with new value of specified setting and flushes it to disk. */
+	void Append(FName Tag, const FSettingValue& Value);
+
+	/** Discards all records, is called once they are compacted into the binary save. */
+	void Reset();
+
+protected:
+	/** The path of opened journal. */
+	FString FilenameInternal;
+
+	/** The opened journal file to append records. */
+	TUniquePtr<FArchive> FileWriterInternal = nullptr;
+
+	/** The amount of records appended after the journal was opened or reset. */
+	int32 RecordsNumInternal = 0;
+
+	/** Writes the header into just created journal file. */
+	void WriteHeader();
+};
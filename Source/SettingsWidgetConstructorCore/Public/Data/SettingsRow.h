@@ -5,7 +5,7 @@
 #include "Data/SettingArchetypesData.h"
 #include "Data/SettingFunction.h"
 #include "Data/SettingTag.h"
-#include "SettingsWidgetConstructor/Private/MyDataTable/SWCMyDataTable.h"
+#include "SettingsWidgetConstructorCore/Private/MyDataTable/SWCMyDataTable.h"
 //---
 #include "SettingsRow.generated.h"
 
@@ -27,7 +27,7 @@
   * Does not contain a default states for its value, because it should be set in the DefaultGameUserSettings.ini
   */
 USTRUCT(BlueprintType)
-struct SETTINGSWIDGETCONSTRUCTOR_API FSettingsPrimary
+struct SETTINGSWIDGETCONSTRUCTORCORE_API FSettingsPrimary
 {
 	GENERATED_BODY()
 
@@ -77,8 +77,28 @@ struct SETTINGSWIDGETCONSTRUCTOR_API FSettingsPrimary
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, meta = (Categories = "Settings"))
 	FGameplayTagContainer SettingsToUpdate = FGameplayTagContainer::EmptyContainer;
 
-	/** Created widget of the chosen setting (button, checkbox, combobox, slider, text line, user input). */
-	TWeakObjectPtr<class USettingSubWidget> SettingSubWidget = nullptr;
+	/** Set true if the Getter and Setter can be called outside of the game thread,
+	  * so on boot this setting is applied concurrently with settings of other Static Context objects.
+	  * Is ignored if any of them is a blueprint function, since it can be called only on the game thread.
+	  * @see USettingsSubsystem::ApplySettingsOnBoot */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, AdvancedDisplay)
+	bool bIsThreadSafe = false;
+
+	/** Set true if only the Getter can be called outside of the game thread, e.g: it just reads a config field,
+	  * so on refresh it is evaluated in parallel with getters of other settings. Is implied by Is Thread Safe.
+	  * Is ignored if the Getter is a blueprint function.
+	  * @see USettingsSubsystem::PrefetchGetters */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, AdvancedDisplay)
+	bool bIsThreadSafeGetter = false;
+
+	/** Set true for cheap settings which Setter is called right away even when changes are staged, e.g: subtitles or HUD scale.
+	  * @see USettingsSubsystem::IsStageChanges */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, AdvancedDisplay)
+	bool bIsLive = false;
+
+	/** Defines when the Setter is called after the value was changed, set not immediate for heavy setters to not stall the frame. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, AdvancedDisplay)
+	ESettingExecution Execution = ESettingExecution::Immediate;
 
 	/** The cached object obtained from the Static Context function. */
 	TWeakObjectPtr<UObject> StaticContextObject = nullptr;
@@ -95,7 +115,7 @@ struct SETTINGSWIDGETCONSTRUCTOR_API FSettingsPrimary
 
 	/** Creates a hash value.
 	* @param Other the other object to create a hash value for. */
-	friend SETTINGSWIDGETCONSTRUCTOR_API uint32 GetTypeHash(const FSettingsPrimary& Other);
+	friend SETTINGSWIDGETCONSTRUCTORCORE_API uint32 GetTypeHash(const FSettingsPrimary& Other);
 };
 
 /**
@@ -106,7 +126,7 @@ struct SETTINGSWIDGETCONSTRUCTOR_API FSettingsPrimary
   * @see FSettingsDataBase
   */
 USTRUCT(BlueprintType)
-struct SETTINGSWIDGETCONSTRUCTOR_API FSettingsPicker
+struct SETTINGSWIDGETCONSTRUCTORCORE_API FSettingsPicker
 {
 	GENERATED_BODY()
 
@@ -154,6 +174,10 @@ struct SETTINGSWIDGETCONSTRUCTOR_API FSettingsPicker
 	  * @see FSettingsPicker::SettingsType */
 	const FSettingsDataBase* GetChosenSettingsData() const;
 
+	/** Returns the section of the Settings widget this setting is added to: Header, Content or Footer.
+	  * Only Button and Text Line can be added to Header or Footer, all other settings are always in Content. */
+	EMyVerticalAlignment GetVerticalAlignment() const;
+
 	/** Returns true if row is valid. */
 	FORCEINLINE bool IsValid() const { return !(*this == Empty); }
 
@@ -163,7 +187,42 @@ struct SETTINGSWIDGETCONSTRUCTOR_API FSettingsPicker
 
 	/** Creates a hash value.
 	  * @param Other the other object to create a hash value for. */
-	friend SETTINGSWIDGETCONSTRUCTOR_API uint32 GetTypeHash(const FSettingsPicker& Other);
+	friend SETTINGSWIDGETCONSTRUCTORCORE_API uint32 GetTypeHash(const FSettingsPicker& Other);
+};
+
+/**
+  * The cached results of bound getters of the setting row.
+  * Each result is stamped by the epoch when its getter was called,
+  * so the getter is called again only if the setting was invalidated after that.
+  * @see USettingsSubsystem::InvalidateSettingsCache
+  */
+struct SETTINGSWIDGETCONSTRUCTORCORE_API FSettingsGetterCache
+{
+	/** The epoch when the value getter was called last time, is 0 if never called. */
+	uint32 GetterEpoch = 0;
+
+	/** The epoch when the combobox members getter was called last time, is 0 if never called. */
+	uint32 MembersEpoch = 0;
+
+	/** The epoch when this setting was invalidated last time. */
+	uint32 InvalidatedEpoch = 0;
+
+	/** The settings version of the Static Context object when values of this setting were taken last time, is INDEX_NONE if it is not versioned.
+	  * @see ISettingsVersionSource */
+	int32 SourceVersion = INDEX_NONE;
+
+	/** The cached values by setting types. */
+	bool bIsSet = false;
+	int32 ChosenMemberIndex = INDEX_NONE;
+	double ChosenValue = 0.0;
+	FText Text = FText::GetEmpty();
+	FName UserInput = NAME_None;
+	TArray<FText> Members;
+
+	/** Returns true if the result stamped by specified epoch is outdated, so its getter has to be called again.
+	  * @param ResultEpoch Either GetterEpoch or MembersEpoch.
+	  * @param AllInvalidatedEpoch The epoch when all settings were invalidated last time. */
+	FORCEINLINE bool IsStale(uint32 ResultEpoch, uint32 AllInvalidatedEpoch) const { return ResultEpoch == 0 || ResultEpoch < FMath::Max(InvalidatedEpoch, AllInvalidatedEpoch); }
 };
 
 /**
@@ -174,7 +233,7 @@ struct SETTINGSWIDGETCONSTRUCTOR_API FSettingsPicker
   * Executing UI getters/setters will call automatically bounded chosen functions.
   */
 USTRUCT(BlueprintType)
-struct SETTINGSWIDGETCONSTRUCTOR_API FSettingsRow : public FSWCMyTableRow
+struct SETTINGSWIDGETCONSTRUCTORCORE_API FSettingsRow : public FSWCMyTableRow
 {
 	GENERATED_BODY()
 
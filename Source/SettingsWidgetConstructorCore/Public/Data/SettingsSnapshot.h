@@ -0,0 +1,70 @@
+﻿// Copyright (c) Yevhenii Selivanov
+
+#pragma once
+
+#include "Data/SettingValue.h"
+
+/**
+ * Immutable copy of values of all bound settings, is published by the Settings Subsystem once per frame after settings committed new values.
+ * Can be read from any thread without UObject access, e.g: by audio, animation or AI workers.
+ * Is shared by thread-safe reference, so it stays alive while any reader holds it, even after newer snapshot was published.
+ * @see FSettingsSnapshotSource
+ */
+class SETTINGSWIDGETCONSTRUCTORCORE_API FSettingsSnapshot
+{
+public:
+	FSettingsSnapshot() = default;
+	FSettingsSnapshot(uint64 InVersion, const TMap<FName, FSettingValue>& InValues);
+
+	/** Returns the number that is incremented with each published snapshot, e.g: to skip reading values that were not changed. */
+	FORCEINLINE uint64 GetVersion() const { return VersionInternal; }
+
+	/** Returns the value of specified setting or null if the setting is not found. */
+	const FSettingValue* Find(FName SettingTag) const { return ValuesInternal.Find(SettingTag); }
+
+	/** Returns typed values of specified setting or default one if the setting of this type is not found. */
+	bool GetBool(FName SettingTag, bool bDefault = false) const;
+	int32 GetInt(FName SettingTag, int32 Default = INDEX_NONE) const;
+	double GetFloat(FName SettingTag, double Default = 0.0) const;
+	FName GetName(FName SettingTag, FName Default = NAME_None) const;
+
+protected:
+	/** The number of this snapshot. */
+	uint64 VersionInternal = 0;
+
+	/** Values of all bound settings by their tags. */
+	TMap<FName/*Tag*/, FSettingValue> ValuesInternal;
+};
+
+typedef TSharedRef<const FSettingsSnapshot, ESPMode::ThreadSafe> FSettingsSnapshotRef;
+
+/**
+ * Holds the latest snapshot of one Settings Subsystem, so each game instance publishes its own values.
+ * Take it on the game thread by USettingsSubsystem::GetSnapshotSource() and keep it by reference on workers,
+ * it outlives the subsystem, which publishes the empty snapshot once it is deinitialized.
+ *
+ * const FSettingsSnapshotRef Snapshot = SnapshotSource->Get();
+ * const double Volume = Snapshot->GetFloat(TEXT("Settings.Slider.MasterVolume"));
+ */
+class SETTINGSWIDGETCONSTRUCTORCORE_API FSettingsSnapshotSource
+{
+public:
+	/** Returns the latest published snapshot, is empty if nothing was published yet. Can be called from any thread. */
+	FSettingsSnapshotRef Get() const;
+
+	/** Copies the value of specified setting from the latest snapshot. Can be called from any thread.
+	 * @return false if the setting is not found. */
+	bool ReadValue(FName SettingTag, FSettingValue& OutValue) const;
+
+	/** Publishes new snapshot with specified values, readers see it on next Get. Is called on the game thread only. */
+	void Publish(const TMap<FName, FSettingValue>& Values);
+
+protected:
+	/** Guards only the swap and the copy of the reference, the snapshot itself is never changed. */
+	mutable FRWLock LockInternal;
+
+	/** The latest published snapshot. */
+	FSettingsSnapshotRef CurrentInternal = MakeShared<const FSettingsSnapshot, ESPMode::ThreadSafe>();
+};
+
+typedef TSharedRef<FSettingsSnapshotSource, ESPMode::ThreadSafe> FSettingsSnapshotSourceRef;
@@ -0,0 +1,31 @@
+﻿// Copyright (c) Yevhenii Selivanov
+
+#pragma once
+
+#include "UObject/Interface.h"
+//---
+#include "SettingsVersionSource.generated.h"
+
+UINTERFACE(MinimalAPI, Blueprintable)
+class USettingsVersionSource : public UInterface
+{
+	GENERATED_BODY()
+};
+
+/**
+ * Is implemented by Static Context objects to report when their settings were changed outside of the Settings Subsystem,
+ * so on reopening the menu only getters of changed objects are called again instead of refreshing all settings.
+ * @see USettingsSubsystem::RefreshStaleSettings
+ */
+class SETTINGSWIDGETCONSTRUCTORCORE_API ISettingsVersionSource
+{
+	GENERATED_BODY()
+
+public:
+	/** Returns the counter that has to be incremented by this object each time any of its settings is changed. */
+	UFUNCTION(BlueprintCallable, BlueprintNativeEvent, Category = "Settings Widget Constructor")
+	int32 GetSettingsVersion() const;
+
+	/** Returns the settings version of specified object or INDEX_NONE if it does not implement this interface. */
+	static int32 GetVersion(const UObject* Object);
+};
@@ -10,7 +10,7 @@
  * Automatically extends any cheat manager with settings-related console commands.
  */
 UCLASS()
-class SETTINGSWIDGETCONSTRUCTOR_API USettingsCheatExtension : public UCheatManagerExtension
+class SETTINGSWIDGETCONSTRUCTORCORE_API USettingsCheatExtension : public UCheatManagerExtension
 {
 	GENERATED_BODY()
 
@@ -0,0 +1,119 @@
+﻿// Copyright (c) Yevhenii Selivanov
+
+#pragma once
+
+struct FSettingsPrimary;
+struct FSettingFunctionPicker;
+
+/**
+  * All kinds of bound functions of the setting row that are measured by the profiler.
+  */
+enum class ESettingsProfilerFunction : uint8
+{
+	StaticContext,
+	Getter,
+	Setter,
+	GetMembers,
+	SetMembers
+};
+
+/**
+  * Collected latencies of one bound function of the setting row.
+  */
+struct SETTINGSWIDGETCONSTRUCTORCORE_API FSettingsProfilerStats
+{
+	/** The upper bounds of histogram buckets in microseconds, the last bucket collects everything above. */
+	static constexpr int32 HistogramBucketsNum = 8;
+	static constexpr double HistogramBucketsUs[HistogramBucketsNum] = {10.0, 50.0, 100.0, 500.0, 1000.0, 5000.0, 16667.0, TNumericLimits<double>::Max()};
+
+	/** The tag of the measured setting. */
+	FName Tag = NAME_None;
+
+	/** The kind of the measured function. */
+	ESettingsProfilerFunction Function = ESettingsProfilerFunction::Getter;
+
+	/** The class of the Static Context object the function is called on. */
+	FString ContextClassName;
+
+	/** The name of the measured function. */
+	FName FunctionName = NAME_None;
+
+	/** How many times the function was called. */
+	int64 CallsNum = 0;
+
+	/** Overall time spent in the function. */
+	double TotalSeconds = 0.0;
+
+	/** The longest call of the function. */
+	double MaxSeconds = 0.0;
+
+	/** Amount of calls per latency bucket.
+	 * @see FSettingsProfilerStats::HistogramBucketsUs */
+	int64 Histogram[HistogramBucketsNum] = {};
+
+	/** Returns the average time of one call. */
+	FORCEINLINE double GetAverageSeconds() const { return CallsNum > 0 ? TotalSeconds / static_cast<double>(CallsNum) : 0.0; }
+
+	/** Adds new measured call. */
+	void AddSample(double Seconds);
+};
+
+/**
+  * Opt-in profiler of bound getters and setters of the Settings Widget.
+  * Is disabled by default, enable it with 'SettingsWidget.Profile.Enable 1' console variable.
+  * Console commands:
+  * SettingsWidget.Profile.Dump [N] [Total|Max|Avg|Calls] - prints top N slowest functions.
+  * SettingsWidget.Profile.ExportCSV [Filename] - writes all collected stats into the .csv file.
+  * SettingsWidget.Profile.Reset - clears all collected stats.
+  */
+class SETTINGSWIDGETCONSTRUCTORCORE_API FSettingsProfiler
+{
+public:
+	/** Returns the profiler instance. */
+	static FSettingsProfiler& Get();
+
+	/** Returns true if the profiler collects data. */
+	static bool IsEnabled();
+
+	/** Adds new measured call of specified setting function. Is thread-safe. */
+	void Record(const FSettingsPrimary& Primary, ESettingsProfilerFunction Function, const FSettingFunctionPicker& FunctionPicker, double Seconds);
+
+	/** Removes all collected stats. */
+	void Reset();
+
+	/** Returns copy of all collected stats sorted by specified predicate, the slowest first. */
+	void GetSortedStats(TArray<FSettingsProfilerStats>& OutStats, FName SortBy = NAME_None) const;
+
+	/** Prints top N slowest functions into specified output. */
+	void Dump(FOutputDevice& Ar, int32 TopN, FName SortBy = NAME_None) const;
+
+	/** Writes all collected stats into the .csv file, returns the path of written file or empty string on failure. */
+	FString ExportCSV(const FString& Filename = TEXT("")) const;
+
+	/** Returns the display name of specified function kind. */
+	static const TCHAR* GetFunctionKindName(ESettingsProfilerFunction Function);
+
+protected:
+	/** Guards collected stats since functions might be measured on any thread. */
+	mutable FCriticalSection StatsCriticalSection;
+
+	/** Collected stats of all measured functions. */
+	TMap<TTuple<FName/*Tag*/, ESettingsProfilerFunction>, FSettingsProfilerStats> StatsInternal;
+};
+
+/**
+  * Measures the call of bound setting function in its scope when profiler is enabled.
+  * FSettingsProfilerScope ProfilerScope(Primary, ESettingsProfilerFunction::Getter, Primary.Getter);
+  */
+struct SETTINGSWIDGETCONSTRUCTORCORE_API FSettingsProfilerScope
+{
+	FSettingsProfilerScope(const FSettingsPrimary& InPrimary, ESettingsProfilerFunction InFunction, const FSettingFunctionPicker& InFunctionPicker);
+	~FSettingsProfilerScope();
+
+private:
+	/** Is null when profiler is disabled. */
+	const FSettingsPrimary* Primary = nullptr;
+	const FSettingFunctionPicker* FunctionPicker = nullptr;
+	ESettingsProfilerFunction Function = ESettingsProfilerFunction::Getter;
+	uint64 StartCycles = 0;
+};
@@ -0,0 +1,668 @@
+﻿// Copyright (c) Yevhenii Selivanov
+
+#pragma once
+
+#include "Subsystems/GameInstanceSubsystem.h"
+//---
+#include "Data/SettingsRow.h"
+#include "Data/SettingValue.h"
+#include "Data/SettingsJournal.h"
+#include "Data/SettingsSnapshot.h"
+//---
+#include "Containers/Ticker.h"
+#include "Tasks/Task.h"
+//---
+#include "SettingsSubsystem.generated.h"
+
+enum class ESettingsProfilerFunction : uint8;
+
+/** Is called when the subscribed setting committed new value, its setter was executed and its Settings To Update were updated. */
+DECLARE_DELEGATE_TwoParams(FOnSettingValueChanged, const FSettingTag& /*SettingTag*/, const FSettingValue& /*Value*/);
+DECLARE_DYNAMIC_DELEGATE_TwoParams(FOnSettingValueChangedDynamic, const FSettingTag&, SettingTag, const FSettingValue&, Value);
+
+/**
+ * The callback of gameplay code subscribed to value changes of one setting or all settings under one parent tag.
+ * @see USettingsSubsystem::SubscribeToSetting
+ */
+struct FSettingSubscription
+{
+	/** Identifies this subscription to unsubscribe it. */
+	FDelegateHandle Handle;
+
+	/** If true, the callback is called for changes of all child settings as well, e.g: 'Settings.Checkbox' for all checkboxes. */
+	bool bMatchChildren = false;
+
+	/** The native callback, is not bound for blueprint subscriptions. */
+	FOnSettingValueChanged Callback;
+
+	/** The blueprint callback, is not bound for native subscriptions. */
+	FOnSettingValueChangedDynamic DynamicCallback;
+};
+
+/**
+ * The headless model of settings, is created once per game instance.
+ * Owns rows of the Settings Data Table, their bound getters and setters, cached values, propagation and persistence,
+ * so settings can be loaded, changed and saved at startup or by tools without creating any widget.
+ * The Settings Widget is only a view over this subsystem that shows its values and forwards user input to it.
+ * @see USettingsWidget
+ */
+UCLASS()
+class SETTINGSWIDGETCONSTRUCTORCORE_API USettingsSubsystem : public UGameInstanceSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/* ---------------------------------------------------
+	 *		Public properties
+	 * --------------------------------------------------- */
+
+	DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnSettingChanged, const FSettingTag&, SettingTag);
+
+	/** Is called after the value of the setting was changed, its setter was executed and all its Settings To Update were updated. */
+	UPROPERTY(BlueprintCallable, BlueprintAssignable, Category = "Settings Widget Constructor")
+	FOnSettingChanged OnSettingChanged;
+
+	/** Is called after members of the combobox setting were changed. */
+	UPROPERTY(BlueprintCallable, BlueprintAssignable, Category = "Settings Widget Constructor")
+	FOnSettingChanged OnComboboxMembersChanged;
+
+	DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnSettingLoadingChanged, const FSettingTag&, SettingTag, bool, bIsLoading);
+
+	/** Is called when the async getter of the setting was started and when its result was applied.
+	 * @see FSettingsCombobox::bAsyncGetMembers */
+	UPROPERTY(BlueprintCallable, BlueprintAssignable, Category = "Settings Widget Constructor")
+	FOnSettingLoadingChanged OnSettingLoadingChanged;
+
+	DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnSettingInFlightChanged, const FSettingTag&, SettingTag, bool, bIsInFlight);
+
+	/** Is called when the async setter of the setting was started and when it completed with the latest value.
+	 * @see ESettingExecution::Async */
+	UPROPERTY(BlueprintCallable, BlueprintAssignable, Category = "Settings Widget Constructor")
+	FOnSettingInFlightChanged OnSettingInFlightChanged;
+
+	DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnRestartRequiredChanged, const FSettingTag&, SettingTag, bool, bIsRestartRequired);
+
+	/** Is called when the setting that takes effect after restart was changed from or back to the value the game runs with. */
+	UPROPERTY(BlueprintCallable, BlueprintAssignable, Category = "Settings Widget Constructor")
+	FOnRestartRequiredChanged OnRestartRequiredChanged;
+
+	/* ---------------------------------------------------
+	 *		Public functions
+	 * --------------------------------------------------- */
+
+	/** Returns the settings subsystem of the game instance of specified world context, is null if there is no game instance. */
+	static USettingsSubsystem* Get(const UObject* WorldContextObject);
+
+	/** Returns the settings subsystem of the game instance of specified world context. */
+	UFUNCTION(BlueprintPure, Category = "Settings Widget Constructor", meta = (WorldContext = "WorldContextObject"))
+	static USettingsSubsystem* GetSettingsSubsystem(const UObject* WorldContextObject) { return Get(WorldContextObject); }
+
+	/** Returns the amount of settings rows. */
+	UFUNCTION(BlueprintPure, Category = "Settings Widget Constructor")
+	FORCEINLINE int32 GetSettingsTableRowsNum() const { return SettingsTableRowsInternal.Num(); }
+
+	/** Returns all settings rows. */
+	FORCEINLINE const TMap<FName, FSettingsPicker>& GetSettingsTableRows() const { return SettingsTableRowsInternal; }
+
+	/** Try to find the setting row.
+	* @param PotentialTagName The probable tag name by which the row will be found (for 'VSync' will find a row with 'Settings.Checkbox.VSync' tag). */
+	UFUNCTION(BlueprintPure, Category = "Settings Widget Constructor")
+	const FSettingsPicker& FindSettingRow(FName PotentialTagName) const;
+
+	/** Returns the found row by specified tag.
+	* @param SettingTag The gameplay tag by which the row will be found. */
+	UFUNCTION(BlueprintPure, Category = "Settings Widget Constructor", meta = (AutoCreateRefTerm = "SettingTag"))
+	const FSettingsPicker& GetSettingRow(const FSettingTag& SettingTag) const;
+
+	/** Is returned for tags that are not found in the Settings Data Table. */
+	static constexpr uint16 InvalidSettingId = MAX_uint16;
+
+	/** Returns the dense id assigned to specified setting when the Settings Data Table was loaded, or InvalidSettingId if not found.
+	 * Ids are valid only until rows are reloaded, so persist tags instead of them. */
+	uint16 GetSettingId(const FSettingTag& SettingTag) const;
+
+	/** Returns the tag of the setting by its dense id, or empty tag if id is not valid. */
+	const FSettingTag& GetSettingTagById(uint16 SettingId) const;
+
+	/** Returns the amount of assigned ids, which is the size of all bitsets of settings. */
+	FORCEINLINE int32 GetSettingIdsNum() const { return SettingRowsByIdInternal.Num(); }
+
+	/** Converts specified tags into the bitset by ids of all settings that match any of them, including child tags.
+	 * Do it once for containers that are tested many times, so each test is a bit lookup instead of tag matching. */
+	void GetSettingsBits(const FGameplayTagContainer& Settings, TBitArray<>& OutBits) const;
+
+	/** Returns the bitset by ids of settings that are updated by specified setting, is empty if not found.
+	 * @see FSettingsPrimary::SettingsToUpdate */
+	const TBitArray<>& GetSettingsToUpdateBits(const FSettingTag& SettingTag) const;
+
+	/** Caches setting rows from the Settings Data Table, all previous rows and their bindings are reset. */
+	UFUNCTION(BlueprintCallable, Category = "Settings Widget Constructor")
+	void UpdateSettingsTableRows();
+
+	/** Binds getters and setters of all settings which Static Context object is not bound yet or was destroyed,
+	 * then takes current values of just bound settings from their getters.
+	 * Is cheap for already bound settings, so can be called every time before settings are needed. */
+	UFUNCTION(BlueprintCallable, Category = "Settings Widget Constructor")
+	void BindSettings();
+
+	/** Binds all settings which Static Context object is available and applies values persisted in its configs by calling getters and setters.
+	 * Setters are called only for settings which value in the binary save differs from the config one.
+	 * Settings are applied in order of their Settings To Update, so each setting is applied once after all settings it depends on.
+	 * Settings of different Static Context objects that are marked as thread-safe are applied concurrently.
+	 * Is called on game start and after each map load, settings which Static Context object appears later are applied on next call.
+	 * @see USettingsCoreDataAsset::bApplySettingsOnBootInternal */
+	UFUNCTION(BlueprintCallable, Category = "Settings Widget Constructor")
+	void ApplySettingsOnBoot();
+
+	/** Save all settings into their configs. */
+	UFUNCTION(BlueprintCallable, Category = "Settings Widget Constructor")
+	void SaveSettings();
+
+	/** Returns true if changed values are kept as pending until Apply, so expensive setters are not called on each UI interaction. */
+	UFUNCTION(BlueprintPure, Category = "Settings Widget Constructor")
+	FORCEINLINE bool IsStageChanges() const { return bStageChangesInternal; }
+
+	/** Enables or disables staging of changed values, all pending values are applied on disabling. */
+	UFUNCTION(BlueprintCallable, Category = "Settings Widget Constructor")
+	void SetStageChanges(bool bInStageChanges);
+
+	/** Returns true if there are changed values which setters are not called yet. */
+	UFUNCTION(BlueprintPure, Category = "Settings Widget Constructor")
+	FORCEINLINE bool HasPendingSettings() const { return !PendingValuesInternal.IsEmpty(); }
+
+	/** Calls real setters of all staged values in one batch in order of their Settings To Update, is called on Save Settings as well. */
+	UFUNCTION(BlueprintCallable, Category = "Settings Widget Constructor")
+	void ApplyPendingSettings();
+
+	/** Discards all staged values, real setters are not called and UI shows current values again. */
+	UFUNCTION(BlueprintCallable, Category = "Settings Widget Constructor")
+	void RevertPendingSettings();
+
+	/** Calls real setters of all queued values of specified execution, e.g: to apply level load settings without loading a level.
+	 * @see FSettingsPrimary::Execution */
+	UFUNCTION(BlueprintCallable, Category = "Settings Widget Constructor")
+	void FlushQueuedSettings(ESettingExecution Execution);
+
+	/** Returns true if any setting was changed, but takes effect only after restart. */
+	UFUNCTION(BlueprintPure, Category = "Settings Widget Constructor")
+	FORCEINLINE bool IsRestartRequired() const { return !RestartRequiredSettingsInternal.IsEmpty(); }
+
+	/** Returns true if specified setting was changed, but takes effect only after restart. */
+	UFUNCTION(BlueprintPure, Category = "Settings Widget Constructor", meta = (AutoCreateRefTerm = "SettingTag"))
+	bool IsSettingRequiresRestart(const FSettingTag& SettingTag) const;
+
+	/** Apply all current settings on device. */
+	UFUNCTION(BlueprintCallable, Category = "Settings Widget Constructor")
+	void ApplySettings();
+
+	/** Calls Get Members of specified async combobox in background, its members are updated once the result is received.
+	 * Does nothing if members of this combobox are already loading.
+	 * @see FSettingsCombobox::bAsyncGetMembers */
+	UFUNCTION(BlueprintCallable, Category = "Settings Widget Constructor", meta = (AutoCreateRefTerm = "ComboboxTag"))
+	void RequestComboboxMembers(const FSettingTag& ComboboxTag);
+
+	/** Returns true if the async setter of specified setting is not completed yet. */
+	UFUNCTION(BlueprintPure, Category = "Settings Widget Constructor", meta = (AutoCreateRefTerm = "SettingTag"))
+	bool IsSettingInFlight(const FSettingTag& SettingTag) const;
+
+	/** Waits for all async setters and completes them, e.g: before values are saved. */
+	UFUNCTION(BlueprintCallable, Category = "Settings Widget Constructor")
+	void FlushAsyncSetters();
+
+	/** Returns true if the async getter of specified setting is not finished yet. */
+	UFUNCTION(BlueprintPure, Category = "Settings Widget Constructor", meta = (AutoCreateRefTerm = "SettingTag"))
+	bool IsSettingLoading(const FSettingTag& SettingTag) const;
+
+	/** Takes current values of specified settings from their getters and sets them.
+	 * @param SettingsToUpdate Contains tags of settings that are needed to update. */
+	UFUNCTION(BlueprintCallable, Category = "Settings Widget Constructor", meta = (AutoCreateRefTerm = "SettingsToUpdate"))
+	void UpdateSettings(
+		UPARAM(meta = (Categories = "Settings")) const FGameplayTagContainer& SettingsToUpdate);
+
+	/** Takes current values of specified settings from their getters and sets them.
+	 * Taken values are real, so they are set right away even if changes are staged.
+	 * @param SettingsToUpdate The bitset by ids of settings that are needed to update.
+	 * @see USettingsSubsystem::GetSettingsBits */
+	void UpdateSettingsByIds(const TBitArray<>& SettingsToUpdate);
+
+	/** Takes current values only of settings which Static Context object reports a new version since previous refresh, e.g: on reopening the menu.
+	 * Settings of objects that do not implement the version interface are invalidated, so their getters are called again on next request.
+	 * @see ISettingsVersionSource */
+	UFUNCTION(BlueprintCallable, Category = "Settings Widget Constructor")
+	void RefreshStaleSettings();
+
+	/** Calls outdated getters of specified thread-safe settings in parallel and caches their results,
+	 * so following refresh on the game thread takes values from the cache instead of calling getters one by one.
+	 * Is called on each Update Settings, call it after invalidation of many settings, e.g: on opening the menu.
+	 * @param SettingsToPrefetch Contains tags of settings which getters are needed to call, all settings are prefetched if empty.
+	 * @see FSettingsPrimary::bIsThreadSafeGetter */
+	UFUNCTION(BlueprintCallable, Category = "Settings Widget Constructor", meta = (AutoCreateRefTerm = "SettingsToPrefetch"))
+	void PrefetchGetters(
+		UPARAM(meta = (Categories = "Settings")) const FGameplayTagContainer& SettingsToPrefetch);
+
+	/** Measures the time of calling all bound thread-safe getters split between increasing amount of workers.
+	 * Is called by the 'SettingsWidget.Benchmark.Getters' console command.
+	 * @param Ar The output to print results.
+	 * @param RowsMultiplier How many times each row is evaluated to emulate large tables.
+	 * @param Iterations How many times all rows are evaluated to average the time. */
+	void BenchmarkGetters(FOutputDevice& Ar, int32 RowsMultiplier, int32 Iterations);
+
+	/** Marks cached getter results of specified settings as outdated, so their getters will be called again on next request.
+	 * Call it when the game has changed settings outside of the Settings Subsystem.
+	 * @param SettingsToInvalidate Contains tags of settings which getters are needed to call again. */
+	UFUNCTION(BlueprintCallable, Category = "Settings Widget Constructor", meta = (AutoCreateRefTerm = "SettingsToInvalidate"))
+	void InvalidateSettingsCache(
+		UPARAM(meta = (Categories = "Settings")) const FGameplayTagContainer& SettingsToInvalidate);
+
+	/** Marks cached getter results of all settings as outdated, so all getters will be called again on next request. */
+	UFUNCTION(BlueprintCallable, Category = "Settings Widget Constructor")
+	void InvalidateAllSettingsCache();
+
+	/** Returns the name of found tag by specified function. */
+	UFUNCTION(BlueprintPure, Category = "Settings Widget Constructor", meta = (AutoCreateRefTerm = "SettingFunction"))
+	const FSettingTag& GetTagByFunction(const FSettingFunctionPicker& SettingFunction) const;
+
+	/** Calls specified callback each time specified setting commits new value, staged values are not committed until Apply.
+	 * Is cheaper than listening On Setting Changed, since only subscribers of the changed setting and its parents are called.
+	 * @param SettingTag The setting to listen, or the parent tag of settings if children are matched.
+	 * @param Callback The native callback to call.
+	 * @param bMatchChildren If true, changes of all child settings of specified tag are listened as well.
+	 * @return The handle to unsubscribe. */
+	FDelegateHandle SubscribeToSetting(const FSettingTag& SettingTag, FOnSettingValueChanged&& Callback, bool bMatchChildren = false);
+
+	/** Removes the subscription by its handle. */
+	void UnsubscribeFromSetting(FDelegateHandle& InOutHandle);
+
+	/** Calls specified event each time specified setting commits new value.
+	 * @see USettingsSubsystem::SubscribeToSetting */
+	UFUNCTION(BlueprintCallable, Category = "Settings Widget Constructor", meta = (DisplayName = "Subscribe To Setting", AutoCreateRefTerm = "SettingTag"))
+	void K2_SubscribeToSetting(const FSettingTag& SettingTag, FOnSettingValueChangedDynamic Callback, bool bMatchChildren = false);
+
+	/** Removes the subscription of specified event from specified setting. */
+	UFUNCTION(BlueprintCallable, Category = "Settings Widget Constructor", meta = (DisplayName = "Unsubscribe From Setting", AutoCreateRefTerm = "SettingTag"))
+	void K2_UnsubscribeFromSetting(const FSettingTag& SettingTag, FOnSettingValueChangedDynamic Callback);
+
+	/** Publishes values of all bound settings for worker threads right away, otherwise changed values are published once per frame.
+	 * @see FSettingsSnapshot */
+	UFUNCTION(BlueprintCallable, Category = "Settings Widget Constructor")
+	void PublishSnapshot();
+
+	/** Returns the holder of the latest snapshot of this subsystem, keep it by reference to read values from any thread.
+	 * Is taken on the game thread only, while its snapshots can be read from any thread. */
+	FORCEINLINE FSettingsSnapshotSourceRef GetSnapshotSource() const { return SnapshotSourceInternal; }
+
+	/** Returns the latest published snapshot of this subsystem. */
+	FORCEINLINE FSettingsSnapshotRef GetSnapshot() const { return SnapshotSourceInternal->Get(); }
+
+	/** Takes current values of settings bound to specified object, is called by the game after it changed them directly,
+	 * e.g: after UGameUserSettings::SetVSyncEnabled, so the menu shows the new value. Dependent settings are updated if the value was changed.
+	 * @param StaticContextObject The object which settings were changed.
+	 * @param FunctionName The getter or setter of the changed setting, all settings of the object are updated if none. */
+	UFUNCTION(BlueprintCallable, Category = "Settings Widget Constructor", meta = (DefaultToSelf = "StaticContextObject"))
+	void NotifySettingSourceChanged(const UObject* StaticContextObject, FName FunctionName = NAME_None);
+
+	/** Returns tags of all settings bound to specified object. */
+	UFUNCTION(BlueprintPure, Category = "Settings Widget Constructor")
+	void GetSettingsByContext(const UObject* StaticContextObject, FGameplayTagContainer& OutSettings) const;
+
+	/* ---------------------------------------------------
+	 *		Setters by setting types
+	 * --------------------------------------------------- */
+
+	/**
+   	  * Set value to the option by tag.
+   	  * Common function to set setting of an any type by the string.
+   	  * Used by cheat manager to override any setting.
+	  *	@param TagName The key by which the row will be find.
+	  * @param Value The value in a string format.
+	  */
+	UFUNCTION(BlueprintCallable, Category = "Settings Widget Constructor|Setters", meta = (AutoCreateRefTerm = "Value"))
+	void SetSettingValue(FName TagName, const FString& Value);
+
+	/** Set the typed value to the setting of any type, the type of the value has to match the setting archetype.
+	 * Members value is set to combobox members, then its chosen index is set if it is not INDEX_NONE. */
+	UFUNCTION(BlueprintCallable, Category = "Settings Widget Constructor|Setters", meta = (AutoCreateRefTerm = "SettingTag,Value"))
+	void SetSettingTypedValue(const FSettingTag& SettingTag, const FSettingValue& Value);
+
+	/** Sets typed values to specified settings in one call without string parsing, e.g: to apply a preset or a diff.
+	 * Setters are called in order of Settings To Update, then dependent settings of all values are updated once.
+	 * Members values set combobox members first, then their chosen index if it is not INDEX_NONE.
+	 * @param SettingTags The settings to set.
+	 * @param Values The values to set, each one is set to the setting with the same index. */
+	UFUNCTION(BlueprintCallable, Category = "Settings Widget Constructor|Setters")
+	void SetSettingValues(const TArray<FSettingTag>& SettingTags, const TArray<FSettingValue>& Values);
+
+	/** Press button. */
+	UFUNCTION(BlueprintCallable, Category = "Settings Widget Constructor|Setters", meta = (AutoCreateRefTerm = "ButtonTag"))
+	void SetSettingButtonPressed(const FSettingTag& ButtonTag);
+
+	/** Toggle checkbox. */
+	UFUNCTION(BlueprintCallable, Category = "Settings Widget Constructor|Setters", meta = (AutoCreateRefTerm = "CheckboxTag"))
+	void SetSettingCheckbox(const FSettingTag& CheckboxTag, bool InValue);
+
+	/** Set chosen member index for a combobox. */
+	UFUNCTION(BlueprintCallable, Category = "Settings Widget Constructor|Setters", meta = (AutoCreateRefTerm = "ComboboxTag"))
+	void SetSettingComboboxIndex(const FSettingTag& ComboboxTag, int32 InValue);
+
+	/** Set new members for a combobox. */
+	UFUNCTION(BlueprintCallable, Category = "Settings Widget Constructor|Setters", meta = (AutoCreateRefTerm = "ComboboxTag,InValue"))
+	void SetSettingComboboxMembers(const FSettingTag& ComboboxTag, const TArray<FText>& InValue);
+
+	/** Set current value for a slider [0...1]. */
+	UFUNCTION(BlueprintCallable, Category = "Settings Widget Constructor|Setters", meta = (AutoCreateRefTerm = "SliderTag"))
+	void SetSettingSlider(const FSettingTag& SliderTag, double InValue);
+
+	/** Set new text. */
+	UFUNCTION(BlueprintCallable, Category = "Settings Widget Constructor|Setters", meta = (AutoCreateRefTerm = "TextLineTag,InValue"))
+	void SetSettingTextLine(const FSettingTag& TextLineTag, const FText& InValue);
+
+	/** Set new text for an input box. */
+	UFUNCTION(BlueprintCallable, Category = "Settings Widget Constructor|Setters", meta = (AutoCreateRefTerm = "UserInputTag"))
+	void SetSettingUserInput(const FSettingTag& UserInputTag, FName InValue);
+
+	/** Set new custom widget for setting by specified tag. */
+	UFUNCTION(BlueprintCallable, Category = "Settings Widget Constructor|Setters", meta = (AutoCreateRefTerm = "CustomWidgetTag"))
+	void SetSettingCustomWidget(const FSettingTag& CustomWidgetTag, UObject* InCustomWidget);
+
+	/* ---------------------------------------------------
+	 *		Getters by setting types
+	 * --------------------------------------------------- */
+
+	/** Returns the typed value of the setting of any type, is empty for buttons and custom widgets. */
+	UFUNCTION(BlueprintPure, Category = "Settings Widget Constructor|Getters", meta = (AutoCreateRefTerm = "SettingTag"))
+	FSettingValue GetSettingTypedValue(const FSettingTag& SettingTag) const;
+
+	/** Returns typed values of specified settings in one call without string conversion, e.g: to take a snapshot or a diff.
+	 * Comboboxes return Members values with their chosen index, so the result can be set back by Set Setting Values.
+	 * @param SettingTags The settings to get.
+	 * @param OutValues The values with the same indices as their settings, the value is empty for buttons, custom widgets and unknown tags. */
+	UFUNCTION(BlueprintPure, Category = "Settings Widget Constructor|Getters")
+	void GetSettingValues(const TArray<FSettingTag>& SettingTags, TArray<FSettingValue>& OutValues) const;
+
+	/** Returns is a checkbox toggled. */
+	UFUNCTION(BlueprintPure, Category = "Settings Widget Constructor|Getters", meta = (AutoCreateRefTerm = "CheckboxTag"))
+	bool GetCheckboxValue(const FSettingTag& CheckboxTag) const;
+
+	/** Returns chosen member index of a combobox. */
+	UFUNCTION(BlueprintPure, Category = "Settings Widget Constructor|Getters", meta = (AutoCreateRefTerm = "ComboboxTag"))
+	int32 GetComboboxIndex(const FSettingTag& ComboboxTag) const;
+
+	/** Get all members of a combobox. */
+	UFUNCTION(BlueprintPure, Category = "Settings Widget Constructor|Getters", meta = (AutoCreateRefTerm = "ComboboxTag"))
+	void GetComboboxMembers(const FSettingTag& ComboboxTag, TArray<FText>& OutMembers) const;
+
+	/** Get current value of a slider [0...1]. */
+	UFUNCTION(BlueprintPure, Category = "Settings Widget Constructor|Getters", meta = (AutoCreateRefTerm = "SliderTag"))
+	double GetSliderValue(const FSettingTag& SliderTag) const;
+
+	/** Get current text of the text line setting. */
+	UFUNCTION(BlueprintPure, Category = "Settings Widget Constructor|Getters", meta = (AutoCreateRefTerm = "TextLineTag"))
+	void GetTextLineValue(const FSettingTag& TextLineTag, FText& OutText) const;
+
+	/** Get current input name of the text input setting. */
+	UFUNCTION(BlueprintPure, Category = "Settings Widget Constructor|Getters", meta = (AutoCreateRefTerm = "UserInputTag"))
+	FName GetUserInputValue(const FSettingTag& UserInputTag) const;
+
+	/** Get custom widget of the setting by specified tag.  */
+	UFUNCTION(BlueprintPure, Category = "Settings Widget Constructor|Getters", meta = (AutoCreateRefTerm = "CustomWidgetTag"))
+	UObject* GetCustomWidget(const FSettingTag& CustomWidgetTag) const;
+
+protected:
+	/* ---------------------------------------------------
+	 *		Protected properties
+	 * --------------------------------------------------- */
+
+	/** Contains all settings. */
+	UPROPERTY(VisibleInstanceOnly, BlueprintReadOnly, Transient, Category = "Settings Widget Constructor", meta = (BlueprintProtected, DisplayName = "Settings Table Rows"))
+	TMap<FName/*Tag*/, FSettingsPicker/*Row*/> SettingsTableRowsInternal;
+
+	/** Contains cached results of bound getters for each setting, is used to avoid calling expensive getters on every refresh.
+	 * Is filled once with all rows, so getters called inside other getters never reallocate it.
+	 * @see USettingsSubsystem::InvalidateSettingsCache */
+	mutable TMap<FName/*Tag*/, FSettingsGetterCache> GetterCacheInternal;
+
+	/** Is incremented on every invalidation and stamps results of called getters. */
+	uint32 SettingsEpochInternal = 1;
+
+	/** The epoch when all settings were invalidated last time. */
+	uint32 AllSettingsInvalidatedEpochInternal = 0;
+
+	/** Dense ids of all settings, are assigned in order of rows once the Settings Data Table is loaded. */
+	TMap<FName/*Tag*/, uint16/*Id*/> SettingIdsInternal;
+
+	/** Rows by their ids, point to values of Settings Table Rows that are not reallocated until rows are reloaded. */
+	TArray<FSettingsPicker*> SettingRowsByIdInternal;
+
+	/** Cached getter results by ids of their settings, point to values of Getter Cache that is filled once with all rows. */
+	TArray<FSettingsGetterCache*> GetterCachesByIdInternal;
+
+	/** Settings To Update of each setting by its id converted into bitsets by ids, so dependency tests don't match tags. */
+	TArray<TBitArray<>> SettingsToUpdateBitsInternal;
+
+	/** Bitsets by ids of settings that match each tag of rows and its parents, so any container is converted by ORing bitsets of its tags. */
+	TMap<FName/*Tag*/, TBitArray<>> SettingsBitsByTagInternal;
+
+	/** Tags of rows by names of their getters and setters, so rows are found by function without scanning all of them. */
+	TMultiMap<FName/*Function*/, FName/*Tag*/> TagsByFunctionInternal;
+
+	/** Tags of bound rows by their Static Context objects, entries of destroyed objects are never matched again. */
+	TMultiMap<TObjectKey<UObject>, FName/*Tag*/> TagsByContextInternal;
+
+	/** Custom widgets set to settings by their tags, are never owned by this subsystem.
+	 * @see USettingsSubsystem::SetSettingCustomWidget */
+	TMap<FName/*Tag*/, TWeakObjectPtr<UObject>> CustomWidgetsInternal;
+
+	/** Subscriptions of gameplay code by tags they listen, so only subscribers of the changed setting are found. */
+	TMultiMap<FName/*Tag*/, FSettingSubscription> SubscriptionsInternal;
+
+	/** Committed values of all bound settings, are copied into the immutable snapshot for worker threads.
+	 * @see FSettingsSnapshot */
+	TMap<FName/*Tag*/, FSettingValue> SnapshotValuesInternal;
+
+	/** Publishes snapshots of this subsystem, is shared with worker threads, so it outlives the subsystem. */
+	FSettingsSnapshotSourceRef SnapshotSourceInternal = MakeShared<FSettingsSnapshotSource, ESPMode::ThreadSafe>();
+
+	/** Is true if any value was committed after the snapshot was published last time. */
+	bool bIsSnapshotDirtyInternal = false;
+
+	/** The handle of the ticker that publishes the snapshot once per frame. */
+	FTSTicker::FDelegateHandle SnapshotTickerInternal;
+
+	/** Values of bound settings as they were loaded from configs, only values that differ from them are written into the binary save. */
+	TMap<FName/*Tag*/, FSettingValue> DefaultValuesInternal;
+
+	/** Values loaded from the binary save, are applied over config values once the setting is bound.
+	 * @see USettingsCoreDataAsset::bUseBinarySaveInternal */
+	TMap<FName/*Tag*/, FSettingValue> SavedValuesInternal;
+
+	/** If true, changed values of not live settings are kept as pending until Apply.
+	 * @see USettingsCoreDataAsset::bStageChangesInternal */
+	bool bStageChangesInternal = false;
+
+	/** Changed values which setters are not called yet, are returned by getters instead of real values. */
+	TMap<FName/*Tag*/, FSettingValue> PendingValuesInternal;
+
+	/** Values of not immediate settings which setters are queued, only the last value of each setting is kept.
+	 * @see FSettingsPrimary::Execution */
+	TMap<FName/*Tag*/, FSettingValue> QueuedValuesInternal;
+
+	/** Settings which values differ from the ones the game runs with, but take effect only after restart. */
+	TSet<FName/*Tag*/> RestartRequiredSettingsInternal;
+
+	/** Values the game runs with of settings that take effect only after restart, are remembered when such setting is changed first time. */
+	TMap<FName/*Tag*/, FSettingValue> RunningValuesInternal;
+
+	/** The handle of the ticker that applies queued settings on next frame. */
+	FTSTicker::FDelegateHandle NextFrameTickerInternal;
+
+	/** Is true while queued or pending values are applied, so their dependent settings are set right away. */
+	bool bIsExecutingInternal = false;
+
+	/** Running Get Members of async comboboxes which results are not applied yet.
+	 * @see FSettingsCombobox::bAsyncGetMembers */
+	TMap<FName/*Tag*/, UE::Tasks::TTask<TArray<FText>>> MembersTasksInternal;
+
+	/** Async comboboxes which Get Members is not thread-safe, so it is called on the game thread on next frame instead. */
+	TSet<FName/*Tag*/> DeferredMembersInternal;
+
+	/** The handle of the ticker that applies results of async getters in one batch. */
+	FTSTicker::FDelegateHandle AsyncGettersTickerInternal;
+
+	/** Running setters of async settings, only one setter per setting runs at the same time.
+	 * @see ESettingExecution::Async */
+	TMap<FName/*Tag*/, UE::Tasks::FTask> SetterTasksInternal;
+
+	/** The latest values of async settings which setters are not completed yet, are returned by getters instead of real values. */
+	TMap<FName/*Tag*/, FSettingValue> InFlightValuesInternal;
+
+	/** Async settings which values were changed again while their setters were running, so the setter is called once more with the latest value. */
+	TSet<FName/*Tag*/> SupersededSettersInternal;
+
+	/** The handle of the ticker that completes async setters. */
+	FTSTicker::FDelegateHandle AsyncSettersTickerInternal;
+
+	/** Records every changed value, so changes are not lost if the game crashes before settings are saved.
+	 * @see USettingsCoreDataAsset::bUseJournalInternal */
+	FSettingsJournal JournalInternal;
+
+	/** The handle of the ticker that compacts the journal by interval. */
+	FTSTicker::FDelegateHandle CompactJournalTickerInternal;
+
+	/* ---------------------------------------------------
+	 *		Protected functions
+	 * --------------------------------------------------- */
+
+	/** Is called when the game instance is initialized, caches setting rows without binding them,
+	 * since Static Context objects like player controller might not exist yet. */
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+
+	/** Is called when the game instance is shutting down. */
+	virtual void Deinitialize() override;
+
+	/** Is called after the map is loaded to apply settings which Static Context object was created by this map. */
+	void OnPostLoadMapWithWorld(UWorld* LoadedWorld);
+
+	/** Splits specified settings into waves by their Settings To Update: each wave depends only on settings of previous waves.
+	 * Settings in a cycle are put into the last wave.
+	 * @param Settings Tags of settings to sort.
+	 * @param OutWaves Sorted waves of settings, settings within one wave are independent of each other. */
+	void GetSettingsApplyWaves(const TArray<FName>& Settings, TArray<TArray<FName>>& OutWaves) const;
+
+	/** Takes the value persisted in the config of the Static Context object from the getter,
+	 * the setter is called only if the binary save has another value for this setting, so settings without saved changes are not set again.
+	 * Is not propagated and not broadcast, so can be called outside of the game thread for thread-safe settings.
+	 * @param Setting The bound setting to apply.
+	 * @param SavedValue The value from the binary save to set instead of the config one, is optional.
+	 * @param OutDefaultValue The value of the config returned by the getter. */
+	static void ApplyPersistedValue(const FSettingsPicker& Setting, const FSettingValue* SavedValue, FSettingValue& OutDefaultValue);
+
+	/** Marks cached getter results of specified settings as outdated.
+	 * @param SettingsToInvalidate The bitset by ids of settings which getters are needed to call again. */
+	void InvalidateSettingsCacheByIds(const TBitArray<>& SettingsToInvalidate);
+
+	/** Calls outdated getters of specified thread-safe settings in parallel and caches their results.
+	 * @param SettingsToPrefetch The bitset by ids of settings which getters are needed to call. */
+	void PrefetchGettersByIds(const TBitArray<>& SettingsToPrefetch);
+
+	/** Remembers current settings versions of Static Context objects of specified settings, is called once their values were taken. */
+	void RecordSourceVersions(const FGameplayTagContainer& Settings);
+
+	/** Returns true if the getter of specified setting can be called outside of the game thread. */
+	static bool IsThreadSafeGetter(const FSettingsPrimary& Primary) { return Primary.bIsThreadSafe || Primary.bIsThreadSafeGetter; }
+
+	/** Calls the bound getter of specified setting directly, without cache. */
+	static FSettingValue ExecuteGetter(const FSettingsPicker& Setting);
+
+	/** Calls the bound setter of specified setting directly, without propagation and broadcasting. */
+	static void ExecuteSetter(const FSettingsPicker& Setting, const FSettingValue& Value);
+
+	/** Writes values of settings that differ from their defaults into the binary save, the file is not touched if nothing was changed.
+	 * @return false if the file failed to be written. */
+	bool SaveBinarySettings();
+
+	/** Replays the journal left by previous session over the binary save and opens it to record new changes. */
+	void OpenJournal();
+
+	/** Writes all journaled changes into the binary save and discards the journal, is called on save and by interval. */
+	void CompactJournal();
+
+	/** Keeps the value of specified setting as pending if changes are staged and the setting is not live,
+	 * or queues it if the setting is not immediate, instead of calling its setter.
+	 * @return true if the value is staged or queued, so the setter should not be called. */
+	bool StageSettingValue(const FSettingsPicker& Setting, const FSettingValue& Value);
+
+	/** Queues the value of specified setting to be applied by its execution, the previous queued value is replaced. */
+	void QueueSettingValue(const FSettingsPicker& Setting, const FSettingValue& Value);
+
+	/** Calls real setters of specified values in order of their Settings To Update, then updates their dependent settings.
+	 * @param bIsApplying If true, dependent settings are set by real values right away even if they are staged, as on Apply. */
+	void ExecuteSettingValues(const TMap<FName, FSettingValue>& Values, bool bIsApplying = true);
+
+	/** Calls the setter of specified async setting in background, if its previous setter is still running, the value is set once it completes. */
+	void ExecuteSetterAsync(const FSettingsPicker& Setting, const FSettingValue& Value);
+
+	/** Invalidates and updates dependent settings of completed async setters in one batch, calls superseded setters again.
+	 * @return true while there are async setters that are not completed yet. */
+	bool TickAsyncSetters(float DeltaTime);
+
+	/** Applies results of finished async getters in one batch on the game thread.
+	 * @return true while there are async getters that are not finished yet. */
+	bool TickAsyncGetters(float DeltaTime);
+
+	/** Waits for all running async getters and discards their results, is called when rows are reset. */
+	void CancelAsyncGetters();
+
+	/** Waits for all running async setters without propagation, superseded values are journaled, but not set. */
+	void CancelAsyncSetters();
+
+	/** Is called right before the map is loaded to apply queued settings that take effect on level load. */
+	void OnPreLoadMap(const FString& MapName);
+
+	/** Returns the pending or queued value of specified setting and type or null if it is not staged. */
+	const FSettingValue* FindPendingValue(const FSettingTag& SettingTag, ESettingValueType Type) const;
+
+	/** Sets the value shown by UI of specified setting without calling its setter. */
+	static void SetCachedValue(FSettingsPicker& Setting, const FSettingValue& Value);
+
+	/** Returns the value shown by UI of specified setting, is empty for buttons and custom widgets. */
+	static FSettingValue GetCachedValue(const FSettingsPicker& Setting);
+
+	/** Is called when the setting committed new value: updates the snapshot for worker threads and calls subscribers of this setting and its parents. */
+	void OnSettingValueCommitted(const FSettingTag& SettingTag, const FSettingValue& Value);
+
+	/** Takes current values of specified settings into the snapshot for worker threads, is called once settings are bound. */
+	void CaptureSnapshotValues(const FGameplayTagContainer& Settings);
+
+	/** Publishes the snapshot if any value was committed during this frame. */
+	bool TickSnapshot(float DeltaTime);
+
+	/** Appends new value of the setting to the journal, so the change is not lost if the game crashes before settings are saved. */
+	void RecordSettingChange(const FSettingTag& SettingTag, const FSettingValue& Value);
+
+	/** Bind and set static object delegate.
+	* @see FSettingsPrimary::OnStaticContext */
+	void TryBindStaticContext(FSettingsPrimary& Primary);
+
+	/** Binds all getters and setters of specified setting to its Static Context object.
+	 * @return false if the Static Context object is not available. */
+	bool BindSetting(FSettingsPicker& Setting);
+
+	/** Returns cached getter results of specified setting or null if the setting is not cached. */
+	FSettingsGetterCache* FindGetterCache(const FSettingTag& SettingTag) const;
+
+	/** Takes the result of the bound getter of specified setting from the cache, the getter is called only if the cached result is outdated.
+	 * @param Setting The setting which getter is bound.
+	 * @param ProfilerFunction Either Getter or GetMembers, defines the measured function and the epoch of the cached result.
+	 * @param CachedValue The member of the getter cache that keeps the result.
+	 * @param InOutValue The result of the getter.
+	 * @param ExecuteGetter Calls the bound getter and writes its result into the passed value. */
+	template <typename T, typename TExecuteGetter>
+	void GetCachedGetterValue(const FSettingsPicker& Setting, ESettingsProfilerFunction ProfilerFunction, T FSettingsGetterCache::* CachedValue, T& InOutValue, TExecuteGetter&& ExecuteGetter) const;
+
+	/** Calls the setter of specified setting with its new value, then updates its Settings To Update and notifies about the change.
+	 * Is shared by all typed setters once the value is changed, the setter is not called if the value is staged. */
+	void CommitSettingValue(const FSettingsPicker& Setting, const FSettingValue& Value);
+
+	/** Marks cached getter results of specified setting as outdated, is called after its setter was executed. */
+	void InvalidateSettingCache(const FSettingTag& SettingTag);
+};
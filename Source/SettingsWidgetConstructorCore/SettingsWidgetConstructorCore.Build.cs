@@ -0,0 +1,37 @@
+﻿// Copyright (c) Yevhenii Selivanov.
+
+using UnrealBuildTool;
+
+public class SettingsWidgetConstructorCore : ModuleRules
+{
+	public SettingsWidgetConstructorCore(ReadOnlyTargetRules Target) : base(Target)
+	{
+		PCHUsage = PCHUsageMode.UseExplicitOrSharedPCHs;
+		CppStandard = CppStandardVersion.Latest;
+
+		PublicDependencyModuleNames.AddRange(new[]
+			{
+				"Core"
+				, "GameplayTags" // Created FSettingTag
+				, "DeveloperSettings" // Created USettingsCoreDataAsset
+				, "SlateCore" // ETextJustify in FSettingsTextLine
+			}
+		);
+
+		PrivateDependencyModuleNames.AddRange(new[]
+			{
+				"CoreUObject", "Engine" // Core
+			}
+		);
+
+		if (Target.bBuildEditor)
+		{
+			// Include Editor modules that are used in this Runtime module
+			PrivateDependencyModuleNames.AddRange(new[]
+				{
+					"UnrealEd" // FDataTableEditorUtils
+				}
+			);
+		}
+	}
+}
@@ -2,7 +2,9 @@
 
 #include "AssetTypeActions_SettingsDataTable.h"
 //---
+#include "SettingsDataTableImporter.h"
 #include "SettingsWidgetConstructorEditorModule.h"
+#include "SettingsWidgetConstructorCoreModule.h"
 #include "Data/SettingsDataTable.h"
 //---
 #include "EditorFramework/AssetImportData.h"
@@ -31,6 +33,34 @@ UObject* USettingsDataTableFactory::FactoryCreateNew(UClass* InClass, UObject* I
 	return NewObject;
 }
 
+// Reimports .json or .csv by the streaming importer, so large tables are not loaded into memory whole
+EReimportResult::Type USettingsDataTableFactory::Reimport(UObject* Obj)
+{
+	USettingsDataTable* SettingsDataTable = Cast<USettingsDataTable>(Obj);
+	UAssetImportData* AssetImportData = SettingsDataTable ? SettingsDataTable->AssetImportData : nullptr;
+	const FString Filename = AssetImportData ? AssetImportData->GetFirstFilename() : TEXT("");
+	if (!FSettingsDataTableImporter::IsSupportedFile(Filename))
+	{
+		return Super::Reimport(Obj);
+	}
+
+	FSettingsDataTableImporter Importer(*SettingsDataTable);
+	const bool bImported = Importer.ImportFromFile(Filename);
+	for (const FString& ErrorIt : Importer.GetErrors())
+	{
+		UE_LOG(LogSettingsWidgetConstructor, Warning, TEXT("%s: %s"), *Filename, *ErrorIt);
+	}
+
+	if (!bImported)
+	{
+		return EReimportResult::Failed;
+	}
+
+	AssetImportData->Update(Filename);
+	SettingsDataTable->MarkPackageDirty();
+	return EReimportResult::Succeeded;
+}
+
 // Imports default data into new Settings Data Table
 void USettingsDataTableFactory::ImportDefaultSettingsDataTable(UObject* NewSettingDataTable)
 {
@@ -3,6 +3,9 @@
 #include "FunctionPickerType/FunctionPickerCustomization.h"
 //---
 #include "Data/SettingFunction.h"
+//---
+#include "Editor.h"
+#include "Misc/CoreDelegates.h"
 
 // The name of class to be customized: SettingFunctionPicker
 const FName FFunctionPickerCustomization::PropertyClassName = FSettingFunctionPicker::StaticStruct()->GetFName();
@@ -52,6 +55,21 @@ void FFunctionPickerCustomization::RegisterFunctionPickerCustomization()
 	);
 
 	PropertyModule.NotifyCustomizationModuleChanged();
+
+	// Functions might be changed, so cached lists have to be rebuilt
+	ReloadCompleteHandle = FCoreUObjectDelegates::ReloadCompleteDelegate.AddLambda([](EReloadCompleteReason Reason)
+	{
+		InvalidateCompatibleFunctionsCache();
+	});
+
+	if (GEditor)
+	{
+		BindBlueprintCompiled();
+	}
+	else
+	{
+		PostEngineInitHandle = FCoreDelegates::OnPostEngineInit.AddStatic(&FFunctionPickerCustomization::BindBlueprintCompiled);
+	}
 }
 
 // Removes customization for the Function Picker
@@ -65,6 +83,34 @@ void FFunctionPickerCustomization::UnregisterFunctionPickerCustomization()
 	FPropertyEditorModule& PropertyModule = FModuleManager::LoadModuleChecked<FPropertyEditorModule>(PropertyEditorModule);
 
 	PropertyModule.UnregisterCustomPropertyTypeLayout(PropertyClassName);
+
+	FCoreUObjectDelegates::ReloadCompleteDelegate.Remove(ReloadCompleteHandle);
+	FCoreDelegates::OnPostEngineInit.Remove(PostEngineInitHandle);
+	if (GEditor)
+	{
+		GEditor->OnBlueprintCompiled().Remove(BlueprintCompiledHandle);
+	}
+
+	InvalidateCompatibleFunctionsCache();
+}
+
+// Removes all cached lists of compatible functions
+void FFunctionPickerCustomization::InvalidateCompatibleFunctionsCache()
+{
+	CompatibleFunctionsCache.Empty();
+}
+
+// Binds the cache invalidation to blueprint compile, is called once the editor is available
+void FFunctionPickerCustomization::BindBlueprintCompiled()
+{
+	FCoreDelegates::OnPostEngineInit.Remove(PostEngineInitHandle);
+	PostEngineInitHandle.Reset();
+
+	if (GEditor
+		&& !BlueprintCompiledHandle.IsValid())
+	{
+		BlueprintCompiledHandle = GEditor->OnBlueprintCompiled().AddStatic(&FFunctionPickerCustomization::InvalidateCompatibleFunctionsCache);
+	}
 }
 
 // Is called for each property on building its row
@@ -119,48 +165,16 @@ void FFunctionPickerCustomization::RefreshCustomProperty()
 
 	ResetSearchableComboBox();
 
-	TArray<FName> FoundList;
-	bool bValidCustomProperty = false;
-	for (TFieldIterator<UFunction> It(ChosenFunctionClass, EFieldIteratorFlags::ExcludeSuper); It; ++It)
-	{
-		const UFunction* FunctionIt = *It;
-		if (FunctionIt
-			&& FunctionIt != TemplateFunctionInternal
-			&& (!bIsStaticFunctionInternal || (FunctionIt->FunctionFlags & FUNC_Static) != 0) // only static functions if specified
-			&& IsSignatureCompatible(FunctionIt))
-		{
-			FName FunctionNameIt = FunctionIt->GetFName();
-			if (FunctionNameIt == CustomPropertyInternal.PropertyValue)
-			{
-				bValidCustomProperty = true;
-			}
-
-			FoundList.AddUnique(MoveTemp(FunctionNameIt));
-		}
-	}
+	const TSharedRef<const FCompatibleFunctions> CompatibleFunctions = FindOrAddCompatibleFunctions(ChosenFunctionClass);
 
 	// Reset function if does not contain in specified class
-	if (!bValidCustomProperty)
+	if (!CompatibleFunctions->FunctionNames.Contains(CustomPropertyInternal.PropertyValue))
 	{
 		SetCustomPropertyValue(NAME_None);
 	}
 
-	for (const FName& ItemData : FoundList)
-	{
-		const FString ItemDataStr = ItemData.ToString();
-		const bool bAlreadyContains = SearchableComboBoxValuesInternal.ContainsByPredicate([&ItemDataStr](const TSharedPtr<FString>& SearchableComboBoxValue)
-		{
-			return SearchableComboBoxValue && SearchableComboBoxValue->Equals(ItemDataStr);
-		});
-
-		if (bAlreadyContains)
-		{
-			continue;
-		}
-
-		// Add this to the searchable text box as an FString so users can type and find it
-		SearchableComboBoxValuesInternal.Emplace(MakeShareable(new FString(ItemData.ToString())));
-	}
+	// Add prebuilt strings to the searchable text box so users can type and find it
+	SearchableComboBoxValuesInternal.Append(CompatibleFunctions->FunctionStrings);
 
 	// Will refresh searchable combo box
 	Super::RefreshCustomProperty();
@@ -191,6 +205,38 @@ const UClass* FFunctionPickerCustomization::GetChosenFunctionClass() const
 	return Data ? Cast<UClass>(ObjectProperty->GetObjectPropertyValue(Data)) : nullptr;
 }
 
+// Returns cached functions of specified class compatible with current template function
+TSharedRef<const FFunctionPickerCustomization::FCompatibleFunctions> FFunctionPickerCustomization::FindOrAddCompatibleFunctions(const UClass* FunctionClass) const
+{
+	const FCompatibleFunctionsKey Key(FunctionClass, TemplateFunctionInternal.Get(), bIsStaticFunctionInternal);
+	if (const TSharedRef<const FCompatibleFunctions>* FoundFunctions = CompatibleFunctionsCache.Find(Key))
+	{
+		return *FoundFunctions;
+	}
+
+	const TSharedRef<FCompatibleFunctions> NewFunctions = MakeShared<FCompatibleFunctions>();
+	for (TFieldIterator<UFunction> It(FunctionClass, EFieldIteratorFlags::ExcludeSuper); It; ++It)
+	{
+		const UFunction* FunctionIt = *It;
+		if (FunctionIt
+			&& FunctionIt != TemplateFunctionInternal
+			&& (!bIsStaticFunctionInternal || (FunctionIt->FunctionFlags & FUNC_Static) != 0) // only static functions if specified
+			&& IsSignatureCompatible(FunctionIt))
+		{
+			bool bAlreadyContains = false;
+			const FName FunctionNameIt = FunctionIt->GetFName();
+			NewFunctions->FunctionNames.Add(FunctionNameIt, &bAlreadyContains);
+			if (!bAlreadyContains)
+			{
+				NewFunctions->FunctionStrings.Emplace(MakeShared<FString>(FunctionNameIt.ToString()));
+			}
+		}
+	}
+
+	CompatibleFunctionsCache.Emplace(Key, NewFunctions);
+	return NewFunctions;
+}
+
 // Check if all signatures of specified function are compatible with current template function
 bool FFunctionPickerCustomization::IsSignatureCompatible(const UFunction* Function) const
 {
@@ -237,6 +283,17 @@ bool FFunctionPickerCustomization::IsSignatureCompatible(const UFunction* Functi
 			{
 				return true;
 			}
+
+			// Object param of the function is compatible if its class is derived from the template one,
+			// so templates with UObject params accept functions with any specific class
+			const FObjectPropertyBase* ObjectA = CastField<FObjectPropertyBase>(A);
+			const FObjectPropertyBase* ObjectB = CastField<FObjectPropertyBase>(B);
+			if (ObjectA && ObjectB
+				&& ObjectA->GetClass() == ObjectB->GetClass()
+				&& ObjectB->PropertyClass && ObjectB->PropertyClass->IsChildOf(ObjectA->PropertyClass))
+			{
+				return true;
+			}
 			return false;
 		}
 
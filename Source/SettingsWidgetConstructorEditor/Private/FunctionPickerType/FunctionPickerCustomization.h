@@ -53,11 +53,36 @@ public:
 	/** Removes customization for the Function Picker. */
 	static void UnregisterFunctionPickerCustomization();
 
+	/** Removes all cached lists of compatible functions, is called on hot reload and blueprint compile since functions might be changed. */
+	static void InvalidateCompatibleFunctionsCache();
+
 protected:
 	/* ---------------------------------------------------
 	*		Protected properties
 	* --------------------------------------------------- */
 
+	/** The prebuilt list of functions compatible with a template function, is shared between all pickers that show the same class. */
+	struct FCompatibleFunctions
+	{
+		/** Names of all compatible functions. */
+		TSet<FName> FunctionNames;
+
+		/** The same names that are ready to be shown in the searchable combo box. */
+		TArray<TSharedPtr<FString>> FunctionStrings;
+	};
+
+	/** The key of cached compatible functions: the chosen class, the template function and whether only static functions are shown. */
+	using FCompatibleFunctionsKey = TTuple<TWeakObjectPtr<const UClass>, TWeakObjectPtr<const UFunction>, bool>;
+
+	/** Editor-wide cache of compatible functions, so functions of the same class are filtered only once for all opened pickers.
+	 * @see FFunctionPickerCustomization::InvalidateCompatibleFunctionsCache() */
+	inline static TMap<FCompatibleFunctionsKey, TSharedRef<const FCompatibleFunctions>> CompatibleFunctionsCache;
+
+	/** Handles of delegates that invalidate the cache. */
+	inline static FDelegateHandle ReloadCompleteHandle;
+	inline static FDelegateHandle BlueprintCompiledHandle;
+	inline static FDelegateHandle PostEngineInitHandle;
+
 	/** Contains the function to be compared with all other functions of a class to show in the list only compatible functions.
 	 * @see FFunctionPickerCustomization::RefreshCustomProperty() */
 	TWeakObjectPtr<UFunction> TemplateFunctionInternal = nullptr;
@@ -114,6 +139,12 @@ protected:
 	 */
 	bool IsSignatureCompatible(const UFunction* Function) const;
 
+	/** Returns cached functions of specified class compatible with current template function, filters them only if not cached yet. */
+	TSharedRef<const FCompatibleFunctions> FindOrAddCompatibleFunctions(const UClass* FunctionClass) const;
+
+	/** Binds the cache invalidation to blueprint compile, is called once the editor is available. */
+	static void BindBlueprintCompiled();
+
 	/** Set Template Function once.
 	 *  @see FFunctionPickerCustomization::TemplateFunctionInternal.
 	 *  @return true if new template function was set. */
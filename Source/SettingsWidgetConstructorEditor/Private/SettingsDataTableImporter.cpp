@@ -0,0 +1,692 @@
+﻿// Copyright (c) Yevhenii Selivanov
+
+#include "SettingsDataTableImporter.h"
+//---
+#include "Data/SettingsDataTable.h"
+//---
+#include "DataTableEditorUtils.h"
+#include "GameplayTagsManager.h"
+#include "HAL/FileManager.h"
+#include "Misc/Paths.h"
+#include "Serialization/JsonReader.h"
+
+namespace SettingsDataTableImporter
+{
+	/** Decodes UTF-8 file into characters on the fly, so the file is parsed without being loaded whole.
+	 * The file is read by buffered blocks, while characters are decoded one by one from the buffer.
+	 * Counts lines and columns of read characters to report errors. */
+	class FUTF8ReaderArchive final : public FArchive
+	{
+	public:
+		explicit FUTF8ReaderArchive(FArchive& InInnerArchive)
+			: InnerArchive(InInnerArchive)
+		{
+			SetIsLoading(true);
+			SkipBOM();
+		}
+
+		/** Reads next character, returns false at the end of file. */
+		bool ReadChar(TCHAR& OutChar)
+		{
+			if (PendingChar)
+			{
+				OutChar = PendingChar;
+				PendingChar = 0;
+				return true;
+			}
+
+			uint8 LeadByte = 0;
+			if (!ReadByte(LeadByte))
+			{
+				return false;
+			}
+
+			uint32 CodePoint = LeadByte;
+			int32 TrailBytesNum = 0;
+			if ((LeadByte & 0xE0) == 0xC0)
+			{
+				CodePoint = LeadByte & 0x1F;
+				TrailBytesNum = 1;
+			}
+			else if ((LeadByte & 0xF0) == 0xE0)
+			{
+				CodePoint = LeadByte & 0x0F;
+				TrailBytesNum = 2;
+			}
+			else if ((LeadByte & 0xF8) == 0xF0)
+			{
+				CodePoint = LeadByte & 0x07;
+				TrailBytesNum = 3;
+			}
+			else if (LeadByte >= 0x80)
+			{
+				CodePoint = UNICODE_BOGUS_CHAR_CODEPOINT;
+			}
+
+			for (int32 Index = 0; Index < TrailBytesNum; ++Index)
+			{
+				uint8 TrailByte = 0;
+				if (!ReadByte(TrailByte)
+					|| (TrailByte & 0xC0) != 0x80)
+				{
+					CodePoint = UNICODE_BOGUS_CHAR_CODEPOINT;
+					break;
+				}
+				CodePoint = (CodePoint << 6) | (TrailByte & 0x3F);
+			}
+
+			if (sizeof(TCHAR) == 2
+				&& CodePoint > 0xFFFF)
+			{
+				// Split into surrogate pair
+				CodePoint -= 0x10000;
+				OutChar = static_cast<TCHAR>(0xD800 + (CodePoint >> 10));
+				PendingChar = static_cast<TCHAR>(0xDC00 + (CodePoint & 0x3FF));
+			}
+			else
+			{
+				OutChar = static_cast<TCHAR>(CodePoint);
+			}
+
+			if (OutChar == TEXT('\n'))
+			{
+				++Line;
+				Column = 0;
+			}
+			else
+			{
+				++Column;
+			}
+
+			return true;
+		}
+
+		/** Returns the line of the last read character, starting from 1. */
+		FORCEINLINE uint32 GetLine() const { return Line; }
+
+		/** Returns the column of the last read character, starting from 1. */
+		FORCEINLINE uint32 GetColumn() const { return Column; }
+
+		virtual void Serialize(void* Data, int64 Length) override
+		{
+			TCHAR* Chars = static_cast<TCHAR*>(Data);
+			const int64 CharsNum = Length / sizeof(TCHAR);
+			for (int64 Index = 0; Index < CharsNum; ++Index)
+			{
+				if (!ReadChar(Chars[Index]))
+				{
+					Chars[Index] = 0;
+					SetError();
+				}
+			}
+		}
+
+		virtual bool AtEnd() override { return !PendingChar && BufferOffset >= Buffer.Num() && InnerArchive.AtEnd(); }
+		virtual int64 Tell() override { return InnerArchive.Tell() - (Buffer.Num() - BufferOffset); }
+		virtual int64 TotalSize() override { return InnerArchive.TotalSize(); }
+		virtual FString GetArchiveName() const override { return InnerArchive.GetArchiveName(); }
+
+	private:
+		/** The size of one block read from the file. */
+		static constexpr int64 BufferSize = 64 * 1024;
+
+		FArchive& InnerArchive;
+		TArray<uint8> Buffer;
+		int32 BufferOffset = 0;
+		TCHAR PendingChar = 0;
+		uint32 Line = 1;
+		uint32 Column = 0;
+
+		bool ReadByte(uint8& OutByte)
+		{
+			if (BufferOffset >= Buffer.Num()
+				&& !FillBuffer())
+			{
+				return false;
+			}
+
+			OutByte = Buffer[BufferOffset++];
+			return true;
+		}
+
+		/** Reads the next block of the file into the buffer, returns false at the end of file. */
+		bool FillBuffer()
+		{
+			const int64 BytesNum = FMath::Min(BufferSize, InnerArchive.TotalSize() - InnerArchive.Tell());
+			if (BytesNum <= 0)
+			{
+				return false;
+			}
+
+			Buffer.SetNumUninitialized(static_cast<int32>(BytesNum), /*bAllowShrinking*/false);
+			BufferOffset = 0;
+			InnerArchive.Serialize(Buffer.GetData(), BytesNum);
+			if (InnerArchive.IsError())
+			{
+				Buffer.Reset();
+				return false;
+			}
+			return true;
+		}
+
+		void SkipBOM()
+		{
+			static constexpr uint8 BOM[] = {0xEF, 0xBB, 0xBF};
+			uint8 Bytes[UE_ARRAY_COUNT(BOM)] = {};
+			if (InnerArchive.TotalSize() < static_cast<int64>(UE_ARRAY_COUNT(BOM)))
+			{
+				return;
+			}
+
+			InnerArchive.Serialize(Bytes, UE_ARRAY_COUNT(Bytes));
+			if (FMemory::Memcmp(Bytes, BOM, UE_ARRAY_COUNT(BOM)) != 0)
+			{
+				InnerArchive.Seek(0);
+			}
+		}
+	};
+
+	/** Collects errors of importing text into the property. */
+	class FImportErrorsOutputDevice final : public FOutputDevice
+	{
+	public:
+		FString Errors;
+
+		virtual void Serialize(const TCHAR* V, ELogVerbosity::Type Verbosity, const FName& Category) override
+		{
+			Errors += V;
+		}
+	};
+
+	/** Reads next record of .csv file, the quoted field might contain commas, quotes and line breaks.
+	 * @return false if there are no more records. */
+	bool ReadCSVRecord(FUTF8ReaderArchive& Reader, TArray<FString>& OutFields)
+	{
+		OutFields.Reset();
+
+		TCHAR Char = 0;
+		if (!Reader.ReadChar(Char))
+		{
+			return false;
+		}
+
+		FString Field;
+		bool bIsQuoted = false;
+		do
+		{
+			if (bIsQuoted)
+			{
+				if (Char != TEXT('"'))
+				{
+					Field.AppendChar(Char);
+					continue;
+				}
+
+				// Doubled quote is escaped quote, single one closes the field
+				TCHAR NextChar = 0;
+				if (!Reader.ReadChar(NextChar))
+				{
+					break;
+				}
+
+				if (NextChar == TEXT('"'))
+				{
+					Field.AppendChar(NextChar);
+					continue;
+				}
+
+				bIsQuoted = false;
+				Char = NextChar;
+			}
+
+			if (Char == TEXT('"'))
+			{
+				bIsQuoted = true;
+			}
+			else if (Char == TEXT(','))
+			{
+				OutFields.Emplace(MoveTemp(Field));
+				Field.Reset();
+			}
+			else if (Char == TEXT('\n'))
+			{
+				break;
+			}
+			else if (Char != TEXT('\r'))
+			{
+				Field.AppendChar(Char);
+			}
+		}
+		while (Reader.ReadChar(Char));
+
+		OutFields.Emplace(MoveTemp(Field));
+		return true;
+	}
+
+	/** The struct or array that receives parsed .json values. */
+	struct FJsonFrame
+	{
+		/** The struct which properties are parsed, is null if it is not a struct. */
+		const UStruct* Struct = nullptr;
+
+		/** The array which elements are parsed, is null if it is not an array. */
+		const FArrayProperty* ArrayProperty = nullptr;
+
+		/** The memory of the struct or array, is null if its values are skipped. */
+		void* Data = nullptr;
+
+		/** Is true if this frame is the row. */
+		bool bIsRow = false;
+	};
+}
+
+// Creates the importer of specified table
+FSettingsDataTableImporter::FSettingsDataTableImporter(USettingsDataTable& InSettingsDataTable)
+	: SettingsDataTableInternal(InSettingsDataTable) {}
+
+// Returns true if specified file can be imported by its extension: .json or .csv
+bool FSettingsDataTableImporter::IsSupportedFile(const FString& Filename)
+{
+	const FString Extension = FPaths::GetExtension(Filename);
+	return Extension.Equals(TEXT("json"), ESearchCase::IgnoreCase)
+		|| Extension.Equals(TEXT("csv"), ESearchCase::IgnoreCase);
+}
+
+// Replaces all rows of the table by rows of specified .json or .csv file
+bool FSettingsDataTableImporter::ImportFromFile(const FString& Filename)
+{
+	ErrorsInternal.Reset();
+	ImportedRowsNumInternal = 0;
+	RowIndexInternal = INDEX_NONE;
+	RowNameInternal = NAME_None;
+
+	if (!IsSupportedFile(Filename))
+	{
+		AddError(FString::Printf(TEXT("'%s' is not .json or .csv file"), *Filename));
+		return false;
+	}
+
+	const TUniquePtr<FArchive> FileReader(IFileManager::Get().CreateFileReader(*Filename));
+	if (!FileReader)
+	{
+		AddError(FString::Printf(TEXT("Failed to open '%s'"), *Filename));
+		return false;
+	}
+
+	// Parse all rows into the transient table first, so the table is not touched if the file is broken
+	StagingTableInternal.Reset(NewObject<USettingsDataTable>(GetTransientPackage(), NAME_None, RF_Transient));
+	const bool bIsJSON = FPaths::GetExtension(Filename).Equals(TEXT("json"), ESearchCase::IgnoreCase);
+	const bool bParsed = bIsJSON ? ImportJSON(*FileReader) : ImportCSV(*FileReader);
+	FileReader->Close();
+
+	if (bParsed)
+	{
+		FDataTableEditorUtils::BroadcastPreChange(&SettingsDataTableInternal, FDataTableEditorUtils::EDataTableChangeInfo::RowList);
+		SettingsDataTableInternal.Modify();
+		SettingsDataTableInternal.SwapRows(*StagingTableInternal);
+		FDataTableEditorUtils::BroadcastPostChange(&SettingsDataTableInternal, FDataTableEditorUtils::EDataTableChangeInfo::RowList);
+	}
+	else
+	{
+		ImportedRowsNumInternal = 0;
+	}
+
+	// Free either previous rows of the table or parsed rows of the broken file right away
+	StagingTableInternal->EmptyTable();
+	StagingTableInternal.Reset();
+
+	return bParsed;
+}
+
+// Parses the .json array of rows token by token
+bool FSettingsDataTableImporter::ImportJSON(FArchive& FileReader)
+{
+	using namespace SettingsDataTableImporter;
+
+	FUTF8ReaderArchive Reader(FileReader);
+	const TSharedRef<TJsonReader<TCHAR>> JsonReader = TJsonReaderFactory<TCHAR>::Create(&Reader);
+
+	const UScriptStruct* RowStruct = FSettingsRow::StaticStruct();
+	static const FString RowNameKey = TEXT("Name");
+
+	FSettingsRow Row;
+	TArray<FJsonFrame> Frames;
+	EJsonNotation Notation = EJsonNotation::Null;
+	while (JsonReader->ReadNext(Notation))
+	{
+		LineInternal = Reader.GetLine();
+		ColumnInternal = Reader.GetColumn();
+
+		if (Notation == EJsonNotation::Error)
+		{
+			break;
+		}
+
+		if (Notation == EJsonNotation::ObjectEnd
+			|| Notation == EJsonNotation::ArrayEnd)
+		{
+			const FJsonFrame Frame = Frames.Num() ? Frames.Pop(/*bAllowShrinking*/false) : FJsonFrame();
+			if (Frame.bIsRow)
+			{
+				AddRow(Row);
+			}
+			continue;
+		}
+
+		if (Frames.IsEmpty())
+		{
+			// The root array of rows
+			if (Notation != EJsonNotation::ArrayStart)
+			{
+				AddError(TEXT("Expected the array of rows"));
+				return false;
+			}
+
+			Frames.Emplace();
+			continue;
+		}
+
+		const bool bIsStart = Notation == EJsonNotation::ObjectStart || Notation == EJsonNotation::ArrayStart;
+		if (Frames.Num() == 1)
+		{
+			// New row in the root array
+			if (Notation != EJsonNotation::ObjectStart)
+			{
+				AddError(TEXT("Expected the row object"));
+				if (bIsStart)
+				{
+					Frames.Emplace();
+				}
+				continue;
+			}
+
+			++RowIndexInternal;
+			RowNameInternal = NAME_None;
+			Row = FSettingsRow();
+
+			FJsonFrame& RowFrameRef = Frames.AddDefaulted_GetRef();
+			RowFrameRef.Struct = RowStruct;
+			RowFrameRef.Data = &Row;
+			RowFrameRef.bIsRow = true;
+			continue;
+		}
+
+		const FJsonFrame& ParentFrame = Frames.Last();
+		const FString& Identifier = JsonReader->GetIdentifier();
+		if (ParentFrame.bIsRow
+			&& Identifier == RowNameKey)
+		{
+			RowNameInternal = *JsonReader->GetValueAsString();
+			continue;
+		}
+
+		// Find the property and memory that receive the value
+		const FProperty* Property = nullptr;
+		void* ValuePtr = nullptr;
+		if (ParentFrame.Struct && ParentFrame.Data)
+		{
+			Property = FindProperty(ParentFrame.Struct, *Identifier);
+			ValuePtr = Property ? Property->ContainerPtrToValuePtr<void>(ParentFrame.Data) : nullptr;
+		}
+		else if (ParentFrame.ArrayProperty && ParentFrame.Data)
+		{
+			FScriptArrayHelper ArrayHelper(ParentFrame.ArrayProperty, ParentFrame.Data);
+			Property = ParentFrame.ArrayProperty->Inner;
+			ValuePtr = ArrayHelper.GetRawPtr(ArrayHelper.AddValue());
+		}
+
+		if (bIsStart)
+		{
+			FJsonFrame& FrameRef = Frames.AddDefaulted_GetRef();
+			if (!ValuePtr)
+			{
+				// Skip values of unknown property
+				continue;
+			}
+
+			if (const FStructProperty* StructProperty = CastField<FStructProperty>(Property);
+				StructProperty && Notation == EJsonNotation::ObjectStart)
+			{
+				FrameRef.Struct = StructProperty->Struct;
+				FrameRef.Data = ValuePtr;
+			}
+			else if (const FArrayProperty* ArrayProperty = CastField<FArrayProperty>(Property);
+				ArrayProperty && Notation == EJsonNotation::ArrayStart)
+			{
+				FScriptArrayHelper(ArrayProperty, ValuePtr).EmptyValues();
+				FrameRef.ArrayProperty = ArrayProperty;
+				FrameRef.Data = ValuePtr;
+			}
+			else
+			{
+				AddError(FString::Printf(TEXT("Unexpected %s for '%s' property"), Notation == EJsonNotation::ObjectStart ? TEXT("object") : TEXT("array"), *Property->GetName()));
+			}
+			continue;
+		}
+
+		if (!ValuePtr
+			|| Notation == EJsonNotation::Null)
+		{
+			continue;
+		}
+
+		FString Value;
+		switch (Notation)
+		{
+		case EJsonNotation::Boolean:
+			Value = JsonReader->GetValueAsBoolean() ? TEXT("true") : TEXT("false");
+			break;
+		case EJsonNotation::Number:
+			Value = JsonReader->GetValueAsNumberString();
+			break;
+		default:
+			Value = JsonReader->GetValueAsString();
+			break;
+		}
+
+		ImportPropertyValue(Property, ValuePtr, Value);
+	}
+
+	const FString& ErrorMessage = JsonReader->GetErrorMessage();
+	if (!ErrorMessage.IsEmpty())
+	{
+		AddError(ErrorMessage);
+		return false;
+	}
+
+	return !Reader.IsError();
+}
+
+// Parses the .csv line by line, the first line is the header with property names
+bool FSettingsDataTableImporter::ImportCSV(FArchive& FileReader)
+{
+	using namespace SettingsDataTableImporter;
+
+	FUTF8ReaderArchive Reader(FileReader);
+	const UScriptStruct* RowStruct = FSettingsRow::StaticStruct();
+
+	// The first column is the row name, others are properties
+	TArray<FString> Fields;
+	if (!ReadCSVRecord(Reader, Fields))
+	{
+		AddError(TEXT("The header is not found"));
+		return false;
+	}
+
+	TArray<const FProperty*> ColumnProperties;
+	ColumnProperties.Reserve(Fields.Num());
+	for (int32 Index = 0; Index < Fields.Num(); ++Index)
+	{
+		ColumnInternal = Index + 1;
+		ColumnProperties.Emplace(Index > 0 ? FindProperty(RowStruct, *Fields[Index].TrimStartAndEnd()) : nullptr);
+	}
+
+	FSettingsRow Row;
+	uint32 RecordLine = Reader.GetLine();
+	while (ReadCSVRecord(Reader, Fields))
+	{
+		LineInternal = RecordLine;
+		RecordLine = Reader.GetLine();
+
+		if (Fields.Num() == 1
+			&& Fields[0].IsEmpty())
+		{
+			// Empty line
+			continue;
+		}
+
+		++RowIndexInternal;
+		RowNameInternal = *Fields[0];
+		Row = FSettingsRow();
+
+		for (int32 Index = 1; Index < Fields.Num(); ++Index)
+		{
+			ColumnInternal = Index + 1;
+			const FProperty* Property = ColumnProperties.IsValidIndex(Index) ? ColumnProperties[Index] : nullptr;
+			if (Property)
+			{
+				ImportPropertyValue(Property, Property->ContainerPtrToValuePtr<void>(&Row), Fields[Index]);
+			}
+		}
+
+		ColumnInternal = 0;
+		AddRow(Row);
+	}
+
+	return !Reader.IsError();
+}
+
+// Resolves all tags of the parsed row and adds it to the staging table
+void FSettingsDataTableImporter::AddRow(FSettingsRow& Row)
+{
+	if (RowNameInternal.IsNone())
+	{
+		AddError(TEXT("The row name is not set, the row is skipped"));
+		return;
+	}
+
+	if (StagingTableInternal->GetRowMap().Contains(RowNameInternal))
+	{
+		AddError(TEXT("The row name is duplicated, the previous row is replaced"));
+	}
+	else
+	{
+		++ImportedRowsNumInternal;
+	}
+
+	FSettingsPrimary& PrimaryRef = Row.SettingsPicker.PrimaryData;
+	ResolveTag(PrimaryRef.Tag);
+	ResolveTags(PrimaryRef.SettingsToUpdate);
+
+	StagingTableInternal->AddRow(RowNameInternal, Row);
+}
+
+// Returns the property of specified struct by its name, is cached
+const FProperty* FSettingsDataTableImporter::FindProperty(const UStruct* Struct, FName PropertyName)
+{
+	const TTuple<const UStruct*, FName> Key(Struct, PropertyName);
+	if (const FProperty* const* CachedProperty = PropertiesCacheInternal.Find(Key))
+	{
+		return *CachedProperty;
+	}
+
+	const FProperty* FoundProperty = Struct ? Struct->FindPropertyByName(PropertyName) : nullptr;
+	if (!FoundProperty)
+	{
+		// Is reported only once for all rows
+		AddError(FString::Printf(TEXT("Property '%s' is not found in '%s', its values are skipped"), *PropertyName.ToString(), Struct ? *Struct->GetName() : TEXT("None")));
+	}
+
+	PropertiesCacheInternal.Emplace(Key, FoundProperty);
+	return FoundProperty;
+}
+
+// Sets the text value to specified property, class and object paths are resolved once for all rows
+void FSettingsDataTableImporter::ImportPropertyValue(const FProperty* Property, void* ValuePtr, const FString& Value)
+{
+	if (!Property
+		|| !ValuePtr)
+	{
+		return;
+	}
+
+	const FObjectProperty* ObjectProperty = CastField<FObjectProperty>(Property);
+	if (ObjectProperty)
+	{
+		if (UObject* const* CachedObject = ObjectsCacheInternal.Find(Value))
+		{
+			ObjectProperty->SetObjectPropertyValue(ValuePtr, *CachedObject);
+			return;
+		}
+	}
+
+	SettingsDataTableImporter::FImportErrorsOutputDevice ImportErrors;
+	const TCHAR* ImportResult = Property->ImportText_Direct(*Value, ValuePtr, nullptr, PPF_ExternalEditor, &ImportErrors);
+	if (!ImportResult
+		|| !ImportErrors.Errors.IsEmpty())
+	{
+		AddError(FString::Printf(TEXT("Failed to import '%s' into '%s' property: %s"), *Value, *Property->GetName(), *ImportErrors.Errors));
+		return;
+	}
+
+	if (ObjectProperty)
+	{
+		ObjectsCacheInternal.Emplace(Value, ObjectProperty->GetObjectPropertyValue(ValuePtr));
+	}
+}
+
+// Replaces specified tag by registered one, reports the tag that is not registered
+void FSettingsDataTableImporter::ResolveTag(FGameplayTag& InOutTag)
+{
+	const FName TagName = InOutTag.GetTagName();
+	if (TagName.IsNone())
+	{
+		return;
+	}
+
+	const FGameplayTag* CachedTag = TagsCacheInternal.Find(TagName);
+	if (!CachedTag)
+	{
+		const FGameplayTag RequestedTag = UGameplayTagsManager::Get().RequestGameplayTag(TagName, /*ErrorIfNotFound*/false);
+		CachedTag = &TagsCacheInternal.Emplace(TagName, RequestedTag);
+	}
+
+	if (!CachedTag->IsValid())
+	{
+		AddError(FString::Printf(TEXT("Tag '%s' is not registered"), *TagName.ToString()));
+		return;
+	}
+
+	InOutTag = *CachedTag;
+}
+
+// Replaces all tags of specified container by registered ones and rebuilds its parent tags
+void FSettingsDataTableImporter::ResolveTags(FGameplayTagContainer& InOutTags)
+{
+	if (InOutTags.IsEmpty())
+	{
+		return;
+	}
+
+	TArray<FGameplayTag> Tags;
+	InOutTags.GetGameplayTagArray(/*Out*/Tags);
+	for (FGameplayTag& TagIt : Tags)
+	{
+		ResolveTag(TagIt);
+	}
+
+	InOutTags = FGameplayTagContainer::CreateFromArray(Tags);
+}
+
+// Adds new error with the position of currently parsed row
+void FSettingsDataTableImporter::AddError(const FString& Message)
+{
+	FString Position;
+	if (RowIndexInternal != INDEX_NONE)
+	{
+		Position += FString::Printf(TEXT("Row %d '%s', "), RowIndexInternal + 1, *RowNameInternal.ToString());
+	}
+	Position += FString::Printf(TEXT("line %u, column %u"), LineInternal, ColumnInternal);
+
+	ErrorsInternal.Emplace(FString::Printf(TEXT("%s: %s"), *Position, *Message));
+}
@@ -8,10 +8,10 @@
 // The name of class to be customized: SettingsPicker
 const FName FSettingsPickerCustomization::PropertyClassName = FSettingsPicker::StaticStruct()->GetFName();
 
-/** The name of the settings data base struct: /Script/SettingsWidgetConstructor.SettingsDataBase. */
+/** The name of the settings data base struct: /Script/SettingsWidgetConstructorCore.SettingsDataBase. */
 const FName FSettingsPickerCustomization::SettingsDataBasePathName = *FSettingsDataBase::StaticStruct()->GetPathName();
 
-/** The name of the Settings Primary struct: /Script/SettingsWidgetConstructor.SettingsPrimary. */
+/** The name of the Settings Primary struct: /Script/SettingsWidgetConstructorCore.SettingsPrimary. */
 const FName FSettingsPickerCustomization::SettingsPrimaryPathName = *FSettingsPrimary::StaticStruct()->GetPathName();
 
 /** The name of the Function Picker struct: /Script/FunctionPicker.FSettingFunctionPicker. */
@@ -0,0 +1,149 @@
+﻿// Copyright (c) Yevhenii Selivanov
+
+#include "SettingsValidateCommandlet.h"
+//---
+#include "Data/SettingsDataTable.h"
+#include "Data/SettingsDataTableValidator.h"
+//---
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "Dom/JsonObject.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/JsonSerializer.h"
+//---
+#include UE_INLINE_GENERATED_CPP_BY_NAME(SettingsValidateCommandlet)
+
+DEFINE_LOG_CATEGORY_STATIC(LogSettingsValidateCommandlet, Log, All);
+
+// Default constructor
+USettingsValidateCommandlet::USettingsValidateCommandlet()
+{
+	IsClient = false;
+	IsServer = false;
+	IsEditor = true;
+	LogToConsole = true;
+}
+
+// Validates all settings tables, returns 0 on success
+int32 USettingsValidateCommandlet::Main(const FString& Params)
+{
+	FString ReportFilename = FPaths::ProjectSavedDir() / TEXT("SettingsWidget") / TEXT("SettingsValidationReport.json");
+	FParse::Value(*Params, TEXT("Report="), ReportFilename);
+
+	int32 MaxPropagationSize = FSettingsDataTableValidator::DefaultMaxPropagationSize;
+	FParse::Value(*Params, TEXT("MaxPropagationSize="), MaxPropagationSize);
+
+	const bool bWarningsAsErrors = FParse::Param(*Params, TEXT("WarningsAsErrors"));
+
+	// Find all settings tables, including the ones created by child classes
+	IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry")).Get();
+	AssetRegistry.SearchAllAssets(/*bSynchronousSearch*/true);
+
+	TArray<FAssetData> AssetsData;
+	AssetRegistry.GetAssetsByClass(USettingsDataTable::StaticClass()->GetClassPathName(), AssetsData, /*bSearchSubClasses*/true);
+
+	TArray<FSettingsValidationReport> Reports;
+	Reports.Reserve(AssetsData.Num());
+	int32 ErrorsNum = 0;
+	int32 WarningsNum = 0;
+	for (const FAssetData& AssetDataIt : AssetsData)
+	{
+		const USettingsDataTable* SettingsDataTable = Cast<USettingsDataTable>(AssetDataIt.GetAsset());
+		if (!SettingsDataTable)
+		{
+			UE_LOG(LogSettingsValidateCommandlet, Error, TEXT("Failed to load '%s' settings table"), *AssetDataIt.GetObjectPathString());
+			++ErrorsNum;
+			continue;
+		}
+
+		FSettingsValidationReport& ReportRef = Reports.Emplace_GetRef(FSettingsDataTableValidator::Validate(*SettingsDataTable, MaxPropagationSize));
+		ReportRef.LogIssues();
+		ErrorsNum += ReportRef.GetIssuesNum(ESettingsValidationSeverity::Error);
+		WarningsNum += ReportRef.GetIssuesNum(ESettingsValidationSeverity::Warning);
+	}
+
+	if (!WriteJsonReport(Reports, ReportFilename))
+	{
+		UE_LOG(LogSettingsValidateCommandlet, Error, TEXT("Failed to write the report to '%s'"), *ReportFilename);
+		return 1;
+	}
+
+	UE_LOG(LogSettingsValidateCommandlet, Display, TEXT("Validated %d settings tables: %d errors, %d warnings, the report is written to '%s'"),
+	       Reports.Num(), ErrorsNum, WarningsNum, *ReportFilename);
+
+	const bool bFailed = ErrorsNum > 0 || (bWarningsAsErrors && WarningsNum > 0);
+	return bFailed ? 1 : 0;
+}
+
+// Writes reports of all validated tables into the .json file, returns true on success
+bool USettingsValidateCommandlet::WriteJsonReport(const TArray<FSettingsValidationReport>& Reports, const FString& Filename)
+{
+	TArray<TSharedPtr<FJsonValue>> TablesJson;
+	TablesJson.Reserve(Reports.Num());
+	int32 ErrorsNum = 0;
+	int32 WarningsNum = 0;
+	for (const FSettingsValidationReport& ReportIt : Reports)
+	{
+		const int32 TableErrorsNum = ReportIt.GetIssuesNum(ESettingsValidationSeverity::Error);
+		const int32 TableWarningsNum = ReportIt.GetIssuesNum(ESettingsValidationSeverity::Warning);
+		ErrorsNum += TableErrorsNum;
+		WarningsNum += TableWarningsNum;
+
+		const TSharedRef<FJsonObject> TableJson = MakeShared<FJsonObject>();
+		TableJson->SetStringField(TEXT("table"), ReportIt.TablePathName);
+		TableJson->SetNumberField(TEXT("rows"), ReportIt.RowsNum);
+		TableJson->SetNumberField(TEXT("errors"), TableErrorsNum);
+		TableJson->SetNumberField(TEXT("warnings"), TableWarningsNum);
+
+		TArray<TSharedPtr<FJsonValue>> IssuesJson;
+		for (const FSettingsValidationIssue& IssueIt : ReportIt.Issues)
+		{
+			const TSharedRef<FJsonObject> IssueJson = MakeShared<FJsonObject>();
+			IssueJson->SetStringField(TEXT("severity"), IssueIt.GetSeverityName());
+			IssueJson->SetStringField(TEXT("row"), IssueIt.RowName.ToString());
+			IssueJson->SetStringField(TEXT("message"), IssueIt.Message);
+			IssuesJson.Emplace(MakeShared<FJsonValueObject>(IssueJson));
+		}
+		TableJson->SetArrayField(TEXT("issues"), IssuesJson);
+
+		TArray<TSharedPtr<FJsonValue>> CyclesJson;
+		for (const TArray<FName>& CycleIt : ReportIt.Cycles)
+		{
+			TArray<TSharedPtr<FJsonValue>> CycleJson;
+			for (const FName RowIt : CycleIt)
+			{
+				CycleJson.Emplace(MakeShared<FJsonValueString>(RowIt.ToString()));
+			}
+			CyclesJson.Emplace(MakeShared<FJsonValueArray>(CycleJson));
+		}
+		TableJson->SetArrayField(TEXT("cycles"), CyclesJson);
+
+		TArray<TSharedPtr<FJsonValue>> CostsJson;
+		for (const FSettingsPropagationCost& CostIt : ReportIt.PropagationCosts)
+		{
+			const TSharedRef<FJsonObject> CostJson = MakeShared<FJsonObject>();
+			CostJson->SetStringField(TEXT("row"), CostIt.RowName.ToString());
+			CostJson->SetNumberField(TEXT("reachable"), CostIt.ReachableNum);
+			CostJson->SetNumberField(TEXT("cascadeCalls"), static_cast<double>(CostIt.CascadeCallsNum));
+			CostJson->SetBoolField(TEXT("unbounded"), CostIt.bIsUnbounded);
+			CostsJson.Emplace(MakeShared<FJsonValueObject>(CostJson));
+		}
+		TableJson->SetArrayField(TEXT("propagation"), CostsJson);
+
+		TablesJson.Emplace(MakeShared<FJsonValueObject>(TableJson));
+	}
+
+	const TSharedRef<FJsonObject> RootJson = MakeShared<FJsonObject>();
+	RootJson->SetNumberField(TEXT("errors"), ErrorsNum);
+	RootJson->SetNumberField(TEXT("warnings"), WarningsNum);
+	RootJson->SetArrayField(TEXT("tables"), TablesJson);
+
+	FString JsonString;
+	const TSharedRef<TJsonWriter<>> JsonWriter = TJsonWriterFactory<>::Create(&JsonString);
+	if (!FJsonSerializer::Serialize(RootJson, JsonWriter))
+	{
+		return false;
+	}
+
+	return FFileHelper::SaveStringToFile(JsonString, *Filename);
+}
@@ -19,6 +19,10 @@ public:
 	virtual FText GetDisplayName() const override;
 	virtual UObject* FactoryCreateNew(UClass* InClass, UObject* InParent, FName InName, EObjectFlags Flags, UObject* Context, FFeedbackContext* Warn) override;
 
+	/** Reimports .json or .csv by the streaming importer, so large tables are not loaded into memory whole.
+	 * @see FSettingsDataTableImporter */
+	virtual EReimportResult::Type Reimport(UObject* Obj) override;
+
 protected:
 	/** Imports default data into new Settings Data Table. */
 	virtual void ImportDefaultSettingsDataTable(UObject* NewSettingDataTable);
@@ -0,0 +1,96 @@
+﻿// Copyright (c) Yevhenii Selivanov
+
+#pragma once
+
+#include "GameplayTagContainer.h"
+//---
+#include "Data/SettingsDataTable.h"
+//---
+#include "UObject/StrongObjectPtr.h"
+
+/**
+ * Imports rows of the Settings Data Table from .json or .csv file without building the whole document in memory.
+ * The file is read by buffered blocks and parsed token by token directly into row structs, so no intermediate json objects or strings of the whole file are created.
+ * Parsed rows are staged in the transient table and swapped with rows of the table only if the whole file is parsed,
+ * so the broken file never empties the table, while rows are never copied from staging.
+ * Lookups of properties, classes and setting tags are cached, so they are resolved only once for all rows.
+ * Both formats are the same as exported by the generic data table: 'Export as JSON' and 'Export as CSV'.
+ *
+ * FSettingsDataTableImporter Importer(SettingsDataTable);
+ * const bool bSucceeded = Importer.ImportFromFile(Filename);
+ */
+class SETTINGSWIDGETCONSTRUCTOREDITOR_API FSettingsDataTableImporter
+{
+public:
+	/** Creates the importer of specified table. */
+	explicit FSettingsDataTableImporter(USettingsDataTable& InSettingsDataTable);
+
+	/** Returns true if specified file can be imported by its extension: .json or .csv. */
+	static bool IsSupportedFile(const FString& Filename);
+
+	/** Replaces all rows of the table by rows of specified .json or .csv file.
+	 * @return false if the file can't be read or parsed, then the table is not changed, all found errors are available by GetErrors(). */
+	bool ImportFromFile(const FString& Filename);
+
+	/** Returns all errors found during the import with their row, line and column. */
+	FORCEINLINE const TArray<FString>& GetErrors() const { return ErrorsInternal; }
+
+	/** Returns amount of imported rows. */
+	FORCEINLINE int32 GetImportedRowsNum() const { return ImportedRowsNumInternal; }
+
+protected:
+	/** The table to import rows into. */
+	USettingsDataTable& SettingsDataTableInternal;
+
+	/** All errors found during the import. */
+	TArray<FString> ErrorsInternal;
+
+	/** Amount of imported rows. */
+	int32 ImportedRowsNumInternal = 0;
+
+	/** The transient table of parsed rows, its rows are swapped with the imported table once the whole file is parsed. */
+	TStrongObjectPtr<USettingsDataTable> StagingTableInternal;
+
+	/** The index of currently parsed row, is used to report errors. */
+	int32 RowIndexInternal = INDEX_NONE;
+
+	/** The name of currently parsed row, is used to report errors. */
+	FName RowNameInternal = NAME_None;
+
+	/** The line and column of the parsed token, is used to report errors. */
+	uint32 LineInternal = 0;
+	uint32 ColumnInternal = 0;
+
+	/** Cached properties by their struct and name, the same fields are found in every row. */
+	TMap<TTuple<const UStruct*, FName>, const FProperty*> PropertiesCacheInternal;
+
+	/** Cached classes and objects by their path, many rows share the same Static Context and Setter classes. */
+	TMap<FString, UObject*> ObjectsCacheInternal;
+
+	/** Cached requested setting tags by their names. */
+	TMap<FName, FGameplayTag> TagsCacheInternal;
+
+	/** Parses the .json array of rows token by token. */
+	bool ImportJSON(FArchive& FileReader);
+
+	/** Parses the .csv line by line, the first line is the header with property names. */
+	bool ImportCSV(FArchive& FileReader);
+
+	/** Resolves all tags of the parsed row and adds it to the staging table. */
+	void AddRow(FSettingsRow& Row);
+
+	/** Returns the property of specified struct by its name, is cached. */
+	const FProperty* FindProperty(const UStruct* Struct, FName PropertyName);
+
+	/** Sets the text value to specified property, class and object paths are resolved once for all rows. */
+	void ImportPropertyValue(const FProperty* Property, void* ValuePtr, const FString& Value);
+
+	/** Replaces specified tag by registered one, reports the tag that is not registered. */
+	void ResolveTag(FGameplayTag& InOutTag);
+
+	/** Replaces all tags of specified container by registered ones and rebuilds its parent tags. */
+	void ResolveTags(FGameplayTagContainer& InOutTags);
+
+	/** Adds new error with the position of currently parsed row. */
+	void AddError(const FString& Message);
+};
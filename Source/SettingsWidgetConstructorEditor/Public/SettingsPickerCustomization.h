@@ -13,10 +13,10 @@ public:
 	/** The name of class to be customized: SettingsPicker */
 	static const FName PropertyClassName;
 
-	/** The name of the settings data base struct: /Script/SettingsWidgetConstructor.SettingsDataBase */
+	/** The name of the settings data base struct: /Script/SettingsWidgetConstructorCore.SettingsDataBase */
 	static const FName SettingsDataBasePathName;
 
-	/** The name of the Settings Primary struct: /Script/SettingsWidgetConstructor.SettingsPrimary */
+	/** The name of the Settings Primary struct: /Script/SettingsWidgetConstructorCore.SettingsPrimary */
 	static const FName SettingsPrimaryPathName;
 
 	/** The name of the Function Picker struct: /Script/FunctionPicker.SWCFunctionPicker */
@@ -0,0 +1,35 @@
+﻿// Copyright (c) Yevhenii Selivanov
+
+#pragma once
+
+#include "Commandlets/Commandlet.h"
+//---
+#include "SettingsValidateCommandlet.generated.h"
+
+struct FSettingsValidationReport;
+
+/**
+ * Loads every Settings Data Table of the project and validates it without creating any UI:
+ * reports cycles of SettingsToUpdate chains, dead bindings and worst-case propagation sizes.
+ * Writes the .json report for CI and returns non-zero code if any error is found.
+ *
+ * Usage:
+ * UnrealEditor-Cmd.exe <Project>.uproject -run=SettingsValidate [-Report=<Path.json>] [-MaxPropagationSize=<N>] [-WarningsAsErrors]
+ * @see FSettingsDataTableValidator
+ */
+UCLASS()
+class SETTINGSWIDGETCONSTRUCTOREDITOR_API USettingsValidateCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	/** Default constructor. */
+	USettingsValidateCommandlet();
+
+	/** Validates all settings tables, returns 0 on success. */
+	virtual int32 Main(const FString& Params) override;
+
+protected:
+	/** Writes reports of all validated tables into the .json file, returns true on success. */
+	static bool WriteJsonReport(const TArray<FSettingsValidationReport>& Reports, const FString& Filename);
+};
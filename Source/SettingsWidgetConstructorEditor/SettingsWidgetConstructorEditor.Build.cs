@@ -26,8 +26,11 @@ public class SettingsWidgetConstructorEditor : ModuleRules
 				, "ToolWidgets" // SSearchableComboBox
 				, "DataTableEditor", "DesktopPlatform", "EditorFramework", "ToolMenus" // Editor data table
 				, "UMG", "Kismet", "KismetCompiler" // Editor user widget
+				, "AssetRegistry", "Json" // USettingsValidateCommandlet
+				, "GameplayTags" // FSettingsDataTableImporter
 				// My modules
-				, "SettingsWidgetConstructor" // USettingsDataTable
+				, "SettingsWidgetConstructorCore" // USettingsDataTable
+				, "SettingsWidgetConstructor" // USettingsWidget
 			}
 		);
 	}